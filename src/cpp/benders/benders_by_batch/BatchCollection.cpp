@@ -1,7 +1,10 @@
 #include "BatchCollection.h"
 
+#include <algorithm>
 #include <cmath>
 #include <iostream>
+
+#include "SubproblemClusters.h"
 BatchCollection::BatchCollection(
     const std::vector<std::string>& sub_problem_names, size_t batch_size,
     Logger logger)
@@ -23,6 +26,11 @@ void BatchCollection::BuildBatches() {
         ")\nWhich means that there is only one batch!");
   }
   number_of_batch_ = std::ceil(double(sub_problems_number_) / batch_size_);
+  batch_collections_.clear();
+  if (construction_ == BatchConstruction::STRATIFIED) {
+    BuildStratifiedBatches();
+    return;
+  }
   for (auto id = 0; id < number_of_batch_ - 1; id++) {
     Batch b;
     b.id = id;
@@ -40,3 +48,35 @@ void BatchCollection::BuildBatches() {
       sub_problem_names_.end());
   batch_collections_.push_back(last);
 }
+
+/*!
+ * \brief deals the subproblems, ordered by week then MC year, to the batches
+ * in turn, so that each batch spreads over the weeks of the year and over the
+ * MC years rather than holding the neighbouring weeks of a few years
+ */
+void BatchCollection::BuildStratifiedBatches() {
+  for (unsigned id(0); id < number_of_batch_; ++id) {
+    Batch batch;
+    batch.id = id;
+    batch_collections_.push_back(batch);
+  }
+  const auto ids = OrderSubproblems(sub_problem_names_,
+                                    SubproblemClustering::WEEK);
+  for (size_t position(0); position < ids.size(); ++position) {
+    batch_collections_[position % number_of_batch_]
+        .sub_problem_names.push_back(sub_problem_names_[ids[position]]);
+  }
+}
+
+size_t AdaptiveBatchSize(size_t batch_size, size_t min_batch_size,
+                         size_t max_batch_size, double misprice_rate,
+                         double batches_per_separation,
+                         unsigned number_of_batch) {
+  if (misprice_rate >= 0.5 || 2 * batches_per_separation > number_of_batch) {
+    batch_size *= 2;
+  } else if (batches_per_separation <= 1) {
+    batch_size /= 2;
+  }
+  return std::clamp(batch_size, std::min(min_batch_size, max_batch_size),
+                    max_batch_size);
+}
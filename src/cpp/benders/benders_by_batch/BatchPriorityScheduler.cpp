@@ -0,0 +1,36 @@
+#include "BatchPriorityScheduler.h"
+
+#include <algorithm>
+
+#include "RandomBatchShuffler.h"
+
+void BatchPriorityScheduler::Reset(unsigned number_of_batch) {
+  number_of_batch_ = number_of_batch;
+  violations_.assign(number_of_batch, 0);
+  last_steps_.assign(number_of_batch, -1);
+}
+
+void BatchPriorityScheduler::Record(unsigned batch_id, double violation,
+                                    int step) {
+  violations_[batch_id] = violation;
+  last_steps_[batch_id] = step;
+}
+
+/*!
+ * \brief stale batches first, from batch_counter in cyclic order, then the
+ * others by decreasing violation, ties kept in cyclic order
+ */
+std::vector<unsigned> BatchPriorityScheduler::GetBatchOrder(
+    unsigned batch_counter, int step) const {
+  auto order =
+      RandomBatchShuffler(number_of_batch_).GetCyclicBatchOrder(batch_counter);
+  const auto is_stale = [this, step](unsigned batch_id) {
+    return last_steps_[batch_id] < 0 ||
+           step - last_steps_[batch_id] >= static_cast<int>(number_of_batch_);
+  };
+  const auto fresh = std::stable_partition(order.begin(), order.end(), is_stale);
+  std::stable_sort(fresh, order.end(), [this](unsigned lhs, unsigned rhs) {
+    return violations_[lhs] > violations_[rhs];
+  });
+  return order;
+}
@@ -24,13 +24,15 @@ void BendersByBatch::InitializeProblems() {
   for (const auto &[problem_name, _] : coupling_map_) {
     problem_names.emplace_back(problem_name);
   }
-  auto batch_size =
+  batch_size_ =
       Options().BATCH_SIZE == 0 ? coupling_map_size : Options().BATCH_SIZE;
   batch_collection_.SetLogger(_logger);
-  batch_collection_.SetBatchSize(batch_size);
+  batch_collection_.SetBatchSize(batch_size_);
+  batch_collection_.SetConstruction(Options().BATCH_CONSTRUCTION);
   batch_collection_.SetSubProblemNames(problem_names);
   batch_collection_.BuildBatches();
   BroadCast(batch_collection_, rank_0);
+  batch_scheduler_.Reset(batch_collection_.NumberOfBatch());
   // Dispatch subproblems to process
   auto problem_count = 0;
   for (const auto &batch : batch_collection_.BatchCollections()) {
@@ -91,7 +93,14 @@ void BendersByBatch::MasterLoop() {
   _data.cumulative_number_of_subproblem_solved = 0;
   cumulative_subproblems_timer_per_iter_ = 0;
   first_unsolved_batch_ = 0;
+  separation_steps_ = 0;
   while (!_data.stop) {
+    if (Options().ADAPTIVE_BATCH_SIZE && separation_steps_ > 0) {
+      UpdateBatchSize();
+    }
+    separation_steps_ = 0;
+    misprices_ = 0;
+    solved_batches_ = 0;
     if (Rank() == rank_0) {
       if (SwitchToIntegerMaster(_data.is_in_initial_relaxation)) {
         _logger->LogAtSwitchToInteger();
@@ -111,8 +120,11 @@ void BendersByBatch::MasterLoop() {
       get_master_value();
       _logger->log_master_solving_duration(get_timer_master());
 
-      random_batch_permutation_ = RandomBatchShuffler(number_of_batch_)
-                                      .GetCyclicBatchOrder(current_batch_id_);
+      random_batch_permutation_ =
+          Options().BATCH_ORDER == BatchOrder::PRIORITY
+              ? batch_scheduler_.GetBatchOrder(current_batch_id_, _data.it)
+              : RandomBatchShuffler(number_of_batch_)
+                    .GetCyclicBatchOrder(current_batch_id_);
     }
     BroadcastXOut();
     BroadcastSingleSubpbCostsUnderApprox();
@@ -153,6 +165,12 @@ void BendersByBatch::SeparationLoop() {
     UpdateRemainingEpsilon();
     _data.number_of_subproblem_solved = 0;
     SolveBatches();
+    // every rank knows misprice_, so that x_cut stays the same on all of them
+    UpdateSeparationParam(misprice_, !misprice_);
+    ++separation_steps_;
+    if (misprice_) {
+      ++misprices_;
+    }
 
     if (Rank() == rank_0) {
       outer_loop_criterion_.push_back(_data.outer_loop_current_iteration_data.outer_loop_criterion);
@@ -168,6 +186,11 @@ void BendersByBatch::ComputeXCut() {
   if (_data.it == 1) {
     _data.x_in = _data.x_out;
     _data.x_cut = _data.x_out;
+  } else if (Options().MASTER_STABILIZATION ==
+             MasterStabilization::LEVEL_BUNDLE) {
+    // x_out is already the level projection around x_in
+    _data.x_in = _data.x_cut;
+    _data.x_cut = _data.x_out;
   } else {
     _data.x_in = _data.x_cut;
     for (const auto &[name, value] : _data.x_out) {
@@ -179,10 +202,9 @@ void BendersByBatch::ComputeXCut() {
 void BendersByBatch::UpdateRemainingEpsilon() {
   if (Rank() == rank_0) {
     auto master_ptr = get_master();
-    int ncols = master_ptr->_solver->get_ncols();
-    std::vector<double> obj(ncols);
-    master_ptr->_solver->get_obj(obj.data(), 0, ncols - 1);
-    remaining_epsilon_ = Gap();
+    const auto obj = master_ptr->_solver->get_obj_view();
+    // the master candidate is above the lower bound with the level bundle
+    remaining_epsilon_ = Gap() - LevelPointGap();
     for (const auto &[candidate_name, x_cut_candidate_value] : _data.x_cut) {
       int col_id = master_ptr->_name_to_id[candidate_name];
       remaining_epsilon_ -=
@@ -190,6 +212,45 @@ void BendersByBatch::UpdateRemainingEpsilon() {
     }
   }
 }
+/*!
+ *  \brief Rebuild the batches with the size adapted to the last master
+ * iteration
+ *
+ *  Only the batches change: the subproblems stay on their process. With
+ * consecutive batches, the next batch is the one holding the first subproblem
+ * of the next batch of the previous collection, so that the cyclic order goes
+ * on. The size only
+ * depends on the iterations, so that the run is reproducible.
+ */
+void BendersByBatch::UpdateBatchSize() {
+  if (Rank() == rank_0) {
+    const auto min_batch_size = static_cast<size_t>(WorldSize());
+    const auto new_batch_size = AdaptiveBatchSize(
+        batch_size_, min_batch_size, coupling_map_.size(),
+        static_cast<double>(misprices_) / separation_steps_,
+        static_cast<double>(solved_batches_) / separation_steps_,
+        number_of_batch_);
+    if (new_batch_size != batch_size_) {
+      const auto next_sub_problem =
+          static_cast<size_t>(current_batch_id_ % number_of_batch_) *
+          batch_size_;
+      batch_size_ = new_batch_size;
+      batch_collection_.SetBatchSize(batch_size_);
+      batch_collection_.BuildBatches();
+      batch_scheduler_.Reset(batch_collection_.NumberOfBatch());
+      current_batch_id_ = next_sub_problem / batch_size_;
+      _logger->display_message(
+          "\tBatch size: " + std::to_string(batch_size_) + " (" +
+          std::to_string(batch_collection_.NumberOfBatch()) + " batches)");
+    }
+  }
+  BroadCast(batch_size_, rank_0);
+  BroadCast(batch_collection_, rank_0);
+  BroadCast(current_batch_id_, rank_0);
+  number_of_batch_ = batch_collection_.NumberOfBatch();
+  random_batch_permutation_.resize(number_of_batch_);
+}
+
 void BendersByBatch::SolveBatches() {
   batch_counter_ = 0;
   cumulative_subproblems_timer_per_iter_ = 0;
@@ -198,6 +259,7 @@ void BendersByBatch::SolveBatches() {
     current_batch_id_ = random_batch_permutation_[first_unsolved_batch_];
     first_unsolved_batch_++;
     const auto &batch = batch_collection_.GetBatchFromId(current_batch_id_);
+    const auto batch_id = current_batch_id_;
     current_batch_id_++;
     const auto &batch_sub_problems = batch.sub_problem_names;
     double batch_subproblems_costs_contribution_in_gap_per_proc = 0;
@@ -206,11 +268,23 @@ void BendersByBatch::SolveBatches() {
     BuildCut(batch_sub_problems,
              &batch_subproblems_costs_contribution_in_gap_per_proc,
              external_loop_criterion_current_batch);
+    ++solved_batches_;
     Reduce(batch_subproblems_costs_contribution_in_gap_per_proc,
            batch_subproblems_costs_contribution_in_gap, std::plus<double>(),
            rank_0);
     Reduce(GetSubproblemsCpuTime(), cumulative_subproblems_timer_per_iter_,
            std::plus<double>(), rank_0);
+    if (Options().BATCH_ORDER == BatchOrder::PRIORITY) {
+      double batch_misprice = 0;
+      Reduce(batch_misprice_per_proc_, batch_misprice, std::plus<double>(),
+             rank_0);
+      if (Rank() == rank_0) {
+        batch_scheduler_.Record(
+            batch_id,
+            batch_subproblems_costs_contribution_in_gap + batch_misprice,
+            _data.it);
+      }
+    }
     if (Rank() == rank_0) {
       _data.number_of_subproblem_solved += batch_sub_problems.size();
       _data.cumulative_number_of_subproblem_solved += batch_sub_problems.size();
@@ -255,6 +329,7 @@ void BendersByBatch::BuildCut(
   for (const auto &subproblem_map : gathered_subproblem_map) {
     for (auto &&[sub_problem_name, subproblem_data] : subproblem_map) {
       SetSubproblemCost(GetSubproblemCost() + subproblem_data.subproblem_cost);
+      last_subproblem_costs_[sub_problem_name] = subproblem_data.subproblem_cost;
       BoundSimplexIterations(subproblem_data.simplex_iter);
     }
   }
@@ -276,6 +351,7 @@ void BendersByBatch::GetSubproblemCut(
     const std::vector<std::string> &batch_sub_problems,
     double *batch_subproblems_costs_contribution_in_gap_per_proc) {
   *batch_subproblems_costs_contribution_in_gap_per_proc = 0;
+  batch_misprice_per_proc_ = 0;
   const auto &sub_pblm_map = GetSubProblemMap();
 
   for (const auto &[name, worker] : sub_pblm_map) {
@@ -283,9 +359,7 @@ void BendersByBatch::GetSubproblemCut(
                   name) != batch_sub_problems.cend()) {
       Timer subproblem_timer;
       PlainData::SubProblemData subproblem_data;
-      worker->fix_to(_data.x_cut);
-      worker->solve(subproblem_data.lpstatus, Options().OUTPUTROOT,
-                    Options().LAST_MASTER_MPS + MPS_SUFFIX, _writer);
+      SolveSubproblemAtXCut(worker, subproblem_data);
       // worker->get_solution(subproblem_data.solution);
       // TODO not supported yet
       //      if (Options().EXTERNAL_LOOP_OPTIONS.DO_OUTER_LOOP) {
@@ -294,13 +368,13 @@ void BendersByBatch::GetSubproblemCut(
       //        subproblem_data.outer_loop_criterions =
       //            ComputeOuterLoopCriterion(name, solution);
       //      }
-      worker->get_value(subproblem_data.subproblem_cost);  // solution phi(x,s)
       worker->get_subgradient(
           subproblem_data.var_name_and_subgradient);  // dual pi_s
+      StrengthenSubproblemCut(worker, subproblem_data);
       auto subpb_cost_under_approx = GetAlpha_i()[ProblemToId(name)];
       *batch_subproblems_costs_contribution_in_gap_per_proc += std::max(
           subproblem_data.subproblem_cost - subpb_cost_under_approx, 0.0);
-      double cut_value_at_x_cut = subproblem_data.subproblem_cost;
+      double cut_value_at_x_cut = subproblem_data.cut_rhs();
       for (const auto &[candidate_name, x_cut_candidate_value] : _data.x_cut) {
         auto subgradient_at_name =
             subproblem_data.var_name_and_subgradient[candidate_name];
@@ -311,6 +385,8 @@ void BendersByBatch::GetSubproblemCut(
 
       if (subpb_cost_under_approx < cut_value_at_x_cut) {
         misprice_ = false;
+        batch_misprice_per_proc_ +=
+            cut_value_at_x_cut - subpb_cost_under_approx;
       }
       worker->get_splex_num_of_ite_last(subproblem_data.simplex_iter);
       subproblem_data.subproblem_timer = subproblem_timer.elapsed();
@@ -351,6 +427,37 @@ void BendersByBatch::UpdateStoppingCriterion() {
   }
 }
 
+/*!
+ *  \brief Upper bound estimate placing the level-bundle level
+ *
+ *  The batches are not all solved at the same point: the estimate is the
+ * investment cost of the last candidate plus the last cost of each
+ * subproblem. It is not used to stop.
+ */
+double BendersByBatch::LevelUpperBound() const {
+  if (last_subproblem_costs_.size() < coupling_map_.size()) {
+    return 1e20;
+  }
+  const auto master_ptr = get_master();
+  const auto obj = master_ptr->_solver->get_obj_view();
+  double result = 0;
+  for (const auto &[candidate_name, x_cut_candidate_value] : _data.x_cut) {
+    result += obj[master_ptr->_name_to_id.at(candidate_name)] *
+              x_cut_candidate_value;
+  }
+  for (const auto &[name, cost] : last_subproblem_costs_) {
+    result += cost;
+  }
+  return result;
+}
+
+/*!
+ *  \brief No clustered aggregation: a batch holds only part of the
+ * subproblems of a cluster, and the separation test needs the alpha of each
+ * subproblem
+ */
+std::vector<int> BendersByBatch::SubproblemClusters() const { return {}; }
+
 /*!
  *  \brief Check if initial relaxation should stop
  */
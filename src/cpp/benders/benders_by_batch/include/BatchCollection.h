@@ -5,6 +5,7 @@
 #include <vector>
 
 #include "ILogger.h"
+#include "common.h"
 
 struct Batch {
   std::vector<std::string> sub_problem_names;
@@ -23,8 +24,11 @@ class BatchCollection {
   size_t batch_size_;
   std::vector<Batch> batch_collections_;
   unsigned number_of_batch_;
+  BatchConstruction construction_ = BatchConstruction::CONSECUTIVE;
   Logger logger_;
 
+  void BuildStratifiedBatches();
+
  public:
   BatchCollection() = default;
   BatchCollection(const std::vector<std::string> &sub_problem_names,
@@ -33,6 +37,9 @@ class BatchCollection {
 
   void SetLogger(Logger logger) { logger_ = std::move(logger); }
   void SetBatchSize(size_t batch_size) { batch_size_ = batch_size; }
+  void SetConstruction(BatchConstruction construction) {
+    construction_ = construction;
+  }
   void SetSubProblemNames(const std::vector<std::string> &sub_problem_names) {
     sub_problem_names_ = sub_problem_names;
     sub_problems_number_ = sub_problem_names.size();
@@ -51,6 +58,26 @@ class BatchCollection {
     ar &batch_size_;
     ar &batch_collections_;
     ar &number_of_batch_;
+    ar &construction_;
   }
 };
+
+/*!
+ * \brief batch size of the next master iteration with an adaptive batch size
+ *
+ * The size is doubled when half of the separation steps were misprices or
+ * when more than half of the batches had to be solved to exhaust the gap, so
+ * that the last iterations solve the whole set at once. It is halved when the
+ * first batch was enough, cuts being cheaper from small batches.
+ *
+ * \param batch_size : current batch size
+ * \param min_batch_size, max_batch_size : bounds of the batch size
+ * \param misprice_rate : share of the separation steps ending in a misprice
+ * \param batches_per_separation : mean number of batches solved by step
+ * \param number_of_batch : current number of batches
+ */
+size_t AdaptiveBatchSize(size_t batch_size, size_t min_batch_size,
+                         size_t max_batch_size, double misprice_rate,
+                         double batches_per_separation,
+                         unsigned number_of_batch);
 #endif  // SRC_CPP_BENDERS_BENDERS_BY_BATCH_INCLUDE_BATCHCOLLECTION_H_
@@ -0,0 +1,35 @@
+#ifndef SRC_CPP_BENDERS_BENDERS_BY_BATCH_INCLUDE_BATCHPRIORITYSCHEDULER_H_
+#define SRC_CPP_BENDERS_BENDERS_BY_BATCH_INCLUDE_BATCHPRIORITYSCHEDULER_H_
+
+#include <vector>
+
+/*!
+ * \brief orders the batches by the violation of their last cuts
+ *
+ * The violation of a batch is the gap between the costs of its subproblems
+ * and their alphas, plus the violation of its cuts at the master solution.
+ * The batches never solved, or not solved for number_of_batch separation
+ * steps, come first in cyclic order, so that no batch is left aside with an
+ * outdated violation. The order is always a permutation of every batch.
+ */
+class BatchPriorityScheduler {
+ private:
+  unsigned number_of_batch_;
+  std::vector<double> violations_;
+  // separation step of the last solve of each batch, -1 if never solved
+  std::vector<int> last_steps_;
+
+ public:
+  explicit BatchPriorityScheduler(unsigned number_of_batch = 0) {
+    Reset(number_of_batch);
+  }
+
+  /*!
+   * \brief forget the violations, when the batches are rebuilt
+   */
+  void Reset(unsigned number_of_batch);
+  void Record(unsigned batch_id, double violation, int step);
+  [[nodiscard]] std::vector<unsigned> GetBatchOrder(
+      unsigned batch_counter, int step) const;
+};
+#endif  // SRC_CPP_BENDERS_BENDERS_BY_BATCH_INCLUDE_BATCHPRIORITYSCHEDULER_H_
@@ -1,6 +1,7 @@
 #ifndef SRC_CPP_BENDERS_BENDERS_BY_BATCH_INCLUDE_BENDERSBYBATCH_H_
 #define SRC_CPP_BENDERS_BENDERS_BY_BATCH_INCLUDE_BENDERSBYBATCH_H_
 #include "BatchCollection.h"
+#include "BatchPriorityScheduler.h"
 #include "BendersMPI.h"
 #include "common_mpi.h"
 
@@ -23,6 +24,8 @@ class BendersByBatch : public BendersMpi {
   void ComputeXCut() override;
   void UpdateStoppingCriterion() override;
   bool ShouldRelaxationStop() const override;
+  [[nodiscard]] double LevelUpperBound() const override;
+  [[nodiscard]] std::vector<int> SubproblemClusters() const override;
 
  private:
   void GetSubproblemCut(
@@ -30,10 +33,12 @@ class BendersByBatch : public BendersMpi {
       const std::vector<std::string> &batch_sub_problems,
       double *batch_subproblems_costs_contribution_in_gap_per_proc);
   BatchCollection batch_collection_;
+  BatchPriorityScheduler batch_scheduler_;
   void MasterLoop();
   void SolveBatches();
   void SeparationLoop();
   void UpdateRemainingEpsilon();
+  void UpdateBatchSize();
   void BroadcastXOut();
   double Gap() const;
   size_t number_of_batch_;
@@ -42,8 +47,18 @@ class BendersByBatch : public BendersMpi {
   double remaining_epsilon_;
   double cumulative_subproblems_timer_per_iter_;
   bool misprice_;
+  // violation at x_out of the cuts of the current batch, on this process
+  double batch_misprice_per_proc_ = 0;
   int first_unsolved_batch_;
   int batch_counter_;
+  size_t batch_size_;
+  // separation steps, misprices and batches solved since the last master
+  // solve, for the adaptive batch size
+  unsigned separation_steps_ = 0;
+  unsigned misprices_ = 0;
+  unsigned solved_batches_ = 0;
+  // last cost of each subproblem, whatever the point it was solved at
+  std::map<std::string, double> last_subproblem_costs_;
 };
 
 #endif  // SRC_CPP_BENDERS_BENDERS_BY_BATCH_INCLUDE_BENDERSBYBATCH_H_
@@ -1,5 +1,6 @@
 #include "BendersBase.h"
 
+#include <cmath>
 #include <memory>
 #include <mutex>
 #include <numeric>
@@ -9,8 +10,18 @@
 #include "LastIterationReader.h"
 #include "LastIterationWriter.h"
 #include "LogUtils.h"
+#include "SubproblemClusters.h"
+#include "multisolver_interface/ProblemFileCompression.h"
 #include "solver_utils.h"
 
+namespace {
+// below, a reduced cost tolerance is not looser than the solvers' defaults
+// (1e-7 for CLP, 1e-6 for XPRESS): the subproblems are solved exactly
+constexpr double MIN_LOOSE_SUBPROBLEM_TOLERANCE = 1e-6;
+// loss at x_cut, relative to the cost, accepted for a Pareto-optimal cut
+constexpr double PARETO_CUT_RELATIVE_LOSS = 1e-6;
+}  // namespace
+
 BendersBase::BendersBase(const BendersBaseOptions &options, Logger logger,
                          Writer writer,
                          std::shared_ptr<MathLoggerDriver> mathLoggerDriver)
@@ -20,6 +31,7 @@ BendersBase::BendersBase(const BendersBaseOptions &options, Logger logger,
       _logger(std::move(logger)),
       _writer(std::move(writer)),
       mathLoggerDriver_(std::move(mathLoggerDriver)) {
+  initial_separation_param_ = _options.SEPARATION_PARAM;
 }
 
 std::filesystem::path BendersBase::OuterloopOptionsFile() const {
@@ -211,6 +223,17 @@ void BendersBase::UpdateStoppingCriterion() {
 
 bool BendersBase::ShouldBendersStop() {
   UpdateStoppingCriterion();
+  if ((_data.stopping_criterion == StoppingCriterion::absolute_gap ||
+       _data.stopping_criterion == StoppingCriterion::relative_gap) &&
+      !IsMasterSolvedAtFinalGap()) {
+    // the lower bound of a master solved at a loose gap may be too high:
+    // the master is solved again at the solver's default gap before stopping
+    _data.stopping_criterion = StoppingCriterion::empty;
+    master_final_gap_required_ = true;
+  } else if (_data.stopping_criterion == StoppingCriterion::empty) {
+    // the confirming iteration did not converge: back to the loose gaps
+    master_final_gap_required_ = false;
+  }
   return (_data.stopping_criterion != StoppingCriterion::empty) &&
          !_data.is_in_initial_relaxation;
 }
@@ -243,6 +266,7 @@ void BendersBase::UpdateTrace() {
 
 bool BendersBase::is_initial_relaxation_requested() const {
   return (_options.MASTER_FORMULATION == MasterFormulation::INTEGER &&
+          _options.MASTER_STABILIZATION == MasterStabilization::IN_OUT &&
           _options.SEPARATION_PARAM < 1);
 }
 
@@ -261,6 +285,7 @@ void BendersBase::ResetDataPostRelaxation() {
   _data.best_it = 0;
   _data.stopping_criterion = StoppingCriterion::empty;
   _options.SEPARATION_PARAM = 1;
+  initial_separation_param_ = 1;
 }
 
 /*!
@@ -304,13 +329,21 @@ void BendersBase::get_master_value() {
   if (_options.BOUND_ALPHA) {
     _master->fix_alpha(_data.best_ub);
   }
+  if (!_data.x_in.empty()) {
+    // the best point evaluated so far stays feasible for the master, once
+    // alpha is recomputed: the MIP does not have to look for a first solution
+    _master->SetMipStart(_data.x_in);
+  }
+  UpdateMasterRelativeGap();
+  UpdateSubproblemTolerance();
   _master->solve(_data.master_status, _options.OUTPUTROOT,
-                 _options.LAST_MASTER_MPS + MPS_SUFFIX, _writer);
+                 LastMasterFileName(), _writer);
   _master->get(
       _data.x_out, _data.overall_subpb_cost_under_approx,
       _data.single_subpb_costs_under_approx); /*Get the optimal variables of the
                                                  Master Problem*/
   _master->get_value(_data.lb); /*Get the optimal value of the Master Problem*/
+  ComputeLevelPoint();
 
   for (const auto &pairIdName : _master->_id_to_name) {
     _master->_solver->get_ub(&_data.max_invest[pairIdName.second],
@@ -322,6 +355,245 @@ void BendersBase::get_master_value() {
   _data.timer_master = timer_master.elapsed();
 }
 
+/*!
+ *  \brief Solve the integer master in a single branch and bound
+ *
+ *  At each integer solution of the tree, x_out and x_cut are set to the
+ * solution and separate() is called to add the subproblem cuts to the master.
+ * These new rows are also the lazy constraints of the solution, which is
+ * only accepted by the tree when it satisfies them. A solution at the point
+ * separated last gets the same rows without a new iteration. The master is
+ * solved at the final gap, with exact subproblems.
+ *
+ *  \param separate : one Benders iteration at x_cut
+ */
+void BendersBase::SolveMasterSingleTree(const std::function<void()> &separate) {
+  Timer timer_master;
+  _data.single_subpb_costs_under_approx.resize(_data.nsubproblem);
+  master_final_gap_required_ = true;
+  UpdateMasterRelativeGap();
+  UpdateSubproblemTolerance();
+
+  const auto &solver = _master->_solver;
+  bool has_separated = false;
+  std::vector<LazyConstraint> separated_rows;
+  solver->set_lazy_constraint_callback(
+      [this, &separate, &solver, &timer_master, &has_separated,
+       &separated_rows](const std::vector<double> &solution) {
+        _master->ReadPoint(solution, _data.x_out,
+                           _data.overall_subpb_cost_under_approx,
+                           _data.single_subpb_costs_under_approx);
+        // the tree can come back to the same point, e.g. at each pass of the
+        // root: its cuts are the ones of the previous separation
+        if (has_separated && _data.x_out == _data.x_cut) {
+          return separated_rows;
+        }
+        // time spent in the tree since the previous integer solution
+        _data.timer_master = timer_master.elapsed();
+        _data.x_cut = _data.x_out;
+        const int first_row = solver->get_nrows();
+        separate();
+        timer_master.restart();
+        separated_rows = MasterRowsFrom(first_row);
+        has_separated = true;
+        return separated_rows;
+      });
+  try {
+    _master->solve(_data.master_status, _options.OUTPUTROOT,
+                   LastMasterFileName(), _writer);
+    _master->get(_data.x_out, _data.overall_subpb_cost_under_approx,
+                 _data.single_subpb_costs_under_approx);
+    _master->get_value(_data.lb);
+  } catch (...) {
+    solver->set_lazy_constraint_callback(nullptr);
+    throw;
+  }
+  solver->set_lazy_constraint_callback(nullptr);
+  _data.timer_master = timer_master.elapsed();
+}
+
+/*!
+ *  \brief Rows of the master from first_row, the cuts being rows of type L
+ */
+std::vector<LazyConstraint> BendersBase::MasterRowsFrom(int first_row) const {
+  const auto &solver = _master->_solver;
+  const int nrows = solver->get_nrows();
+  std::vector<LazyConstraint> rows;
+  if (nrows <= first_row) {
+    return rows;
+  }
+  const auto matrix = solver->get_rows_view();
+  std::vector<double> rhs(nrows - first_row);
+  solver->get_rhs(rhs.data(), first_row, nrows - 1);
+  rows.reserve(rhs.size());
+  for (int row(first_row); row < nrows; ++row) {
+    auto &constraint = rows.emplace_back();
+    for (int k = matrix.starts[row]; k < matrix.starts[row + 1]; ++k) {
+      constraint.indexes.push_back(matrix.indexes[k]);
+      constraint.values.push_back(matrix.values[k]);
+    }
+    constraint.rhs = rhs[row - first_row];
+  }
+  return rows;
+}
+
+/*!
+ *  \brief Set the relative gap of the next master solve
+ *
+ *  With MASTER_INITIAL_RELATIVE_GAP, the integer master is solved at a tenth
+ * of the current Benders relative gap, between RELATIVE_GAP and
+ * MASTER_INITIAL_RELATIVE_GAP, and at the solver's default gap once
+ * convergence has to be confirmed: the lower bound is the incumbent value of
+ * the master, too high by up to the gap of its solve
+ */
+void BendersBase::UpdateMasterRelativeGap() {
+  master_relative_gap_ = 0;
+  if (_options.MASTER_INITIAL_RELATIVE_GAP <= 0 ||
+      _master->_solver->get_n_integer_vars() == 0) {
+    return;
+  }
+  if (master_final_gap_required_) {
+    _master->_solver->set_mip_relative_gap(-1);
+    _logger->display_message("\tMaster relative gap: solver default");
+    return;
+  }
+  const double final_gap = _options.RELATIVE_GAP;
+  double gap = _options.MASTER_INITIAL_RELATIVE_GAP;
+  if (const double denominator =
+          std::max(std::abs(_data.best_ub), std::abs(_data.lb));
+      denominator > 0) {
+    gap = std::min(gap, 0.1 * (_data.best_ub - _data.lb) / denominator);
+  }
+  master_relative_gap_ = std::max(gap, final_gap);
+  _master->_solver->set_mip_relative_gap(master_relative_gap_);
+
+  std::ostringstream msg;
+  msg << "\tMaster relative gap: " << master_relative_gap_;
+  _logger->display_message(msg.str());
+}
+
+/*!
+ *  \brief Set the reduced cost tolerance of the next subproblem solves
+ *
+ *  With SUBPROBLEM_INITIAL_TOLERANCE, the tolerance is the initial one times
+ * the current Benders relative gap. The subproblems are solved exactly, at
+ * the solver's default tolerance, once it is not looser than the defaults or
+ * once convergence has to be confirmed
+ */
+void BendersBase::UpdateSubproblemTolerance() {
+  if (_options.SUBPROBLEM_INITIAL_TOLERANCE <= 0) {
+    return;
+  }
+  double tolerance = _options.SUBPROBLEM_INITIAL_TOLERANCE;
+  if (master_final_gap_required_) {
+    tolerance = 0;
+  } else if (const double denominator =
+                 std::max(std::abs(_data.best_ub), std::abs(_data.lb));
+             denominator > 0) {
+    tolerance *= std::min(1., (_data.best_ub - _data.lb) / denominator);
+  }
+  if (tolerance < MIN_LOOSE_SUBPROBLEM_TOLERANCE) {
+    tolerance = 0;
+  }
+  if (tolerance != subproblem_tolerance_) {
+    subproblem_tolerance_ = tolerance;
+    std::ostringstream msg;
+    msg << "\tSubproblems tolerance: ";
+    if (subproblem_tolerance_ > 0) {
+      msg << subproblem_tolerance_;
+    } else {
+      msg << "solver default";
+    }
+    _logger->display_message(msg.str());
+  }
+}
+
+/*!
+ *  \brief Display the time spent in the solves of the Pareto-optimal cuts of
+ * the iteration, summed over the subproblems
+ */
+void BendersBase::LogParetoCutsTimer(
+    const SubProblemDataMap &subproblem_data_map) const {
+  if (_options.PARETO_CUT_WEIGHT <= 0) {
+    return;
+  }
+  double pareto_timer = 0;
+  for (const auto &[_, subproblem_data] : subproblem_data_map) {
+    pareto_timer += subproblem_data.pareto_timer;
+  }
+  std::ostringstream msg;
+  msg << "\tPareto-optimal cuts: " << pareto_timer << " s";
+  _logger->display_message(msg.str());
+}
+
+/*!
+ *  \brief Adapt SEPARATION_PARAM to the last iteration
+ *
+ *  With ADAPTIVE_SEPARATION, an iteration improving the best upper bound sets
+ * the parameter back to its initial value, a misprice (no cut separating the
+ * master solution) moves the separation point halfway to x_out.
+ */
+void BendersBase::UpdateSeparationParam() {
+  UpdateSeparationParam(cuts_misprice_, _data.best_it == _data.it);
+}
+
+void BendersBase::UpdateSeparationParam(bool misprice, bool improving) {
+  if (!_options.ADAPTIVE_SEPARATION ||
+      _options.MASTER_STABILIZATION != MasterStabilization::IN_OUT) {
+    return;
+  }
+  const double previous = _options.SEPARATION_PARAM;
+  if (improving) {
+    _options.SEPARATION_PARAM = initial_separation_param_;
+  } else if (misprice) {
+    _options.SEPARATION_PARAM = 0.5 * (1 + _options.SEPARATION_PARAM);
+  }
+  if (_options.SEPARATION_PARAM != previous) {
+    std::ostringstream msg;
+    msg << "\tSeparation parameter: " << _options.SEPARATION_PARAM;
+    _logger->display_message(msg.str());
+  }
+}
+
+/*!
+ *  \brief Replace the master solution by a level-bundle candidate
+ *
+ *  The candidate is the point of the cut model closest to the stability
+ * center x_in whose master objective is at most
+ * lb + LEVEL_BUNDLE_PARAM * (upper bound - lb). The lower bound is the one of
+ * the master solve.
+ */
+void BendersBase::ComputeLevelPoint() {
+  level_point_gap_ = 0;
+  const double upper_bound = LevelUpperBound();
+  if (_options.MASTER_STABILIZATION != MasterStabilization::LEVEL_BUNDLE ||
+      _data.x_in.empty() || upper_bound >= 1e20 || upper_bound <= _data.lb) {
+    return;
+  }
+  const double level =
+      _data.lb + _options.LEVEL_BUNDLE_PARAM * (upper_bound - _data.lb);
+  LevelPoint point;
+  if (_master->SolveLevelProjection(_data.x_in, level,
+                                    _options.LEVEL_BUNDLE_NORM,
+                                    point) != SOLVER_STATUS::OPTIMAL) {
+    _logger->display_message(
+        "\tLevel projection not optimal, master solution kept");
+    return;
+  }
+  _data.x_out = point.x;
+  _data.overall_subpb_cost_under_approx = point.overall_subpb_cost_under_approx;
+  _data.single_subpb_costs_under_approx = point.single_subpb_costs_under_approx;
+  level_point_gap_ = std::max(point.objective - _data.lb, 0.0);
+
+  std::ostringstream msg;
+  msg << "\tLevel: " << level;
+  _logger->display_message(msg.str());
+}
+
+bool BendersBase::IsMasterSolvedAtFinalGap() const {
+  return master_relative_gap_ <= 0;
+}
+
 void BendersBase::DeactivateIntegrityConstraints() const {
   _master->DeactivateIntegrityConstraints();
 }
@@ -331,9 +603,14 @@ void BendersBase::ActivateIntegrityConstraints() const {
 }
 
 void BendersBase::ComputeXCut() {
+  cuts_misprice_ = true;
   if (_data.it == 1) {
     _data.x_in = _data.x_out;
     _data.x_cut = _data.x_out;
+  } else if (_options.MASTER_STABILIZATION ==
+             MasterStabilization::LEVEL_BUNDLE) {
+    // x_out is already the level projection around x_in
+    _data.x_cut = _data.x_out;
   } else {
     for (const auto &[name, value] : _data.x_out) {
       _data.x_cut[name] = _options.SEPARATION_PARAM * _data.x_out[name] +
@@ -386,6 +663,7 @@ void BendersBase::GetSubproblemCut(SubProblemDataMap &subproblem_data_map) {
               const auto &[name, worker] = kvp;
               SolveSubproblem(subproblem_data_map, subproblem_data, name,
                               worker);
+              StrengthenSubproblemCut(worker, subproblem_data);
 
               subproblem_data_map[name] = subproblem_data;
               std::lock_guard guard(m);
@@ -398,14 +676,107 @@ void BendersBase::SolveSubproblem(
     PlainData::SubProblemData &subproblem_data, const std::string &name,
     const std::shared_ptr<SubproblemWorker> &worker) {
   Timer subproblem_timer;
+  SolveSubproblemAtXCut(worker, subproblem_data);
+  worker->get_subgradient(subproblem_data.var_name_and_subgradient);
+  worker->get_splex_num_of_ite_last(subproblem_data.simplex_iter);
+  subproblem_data.subproblem_timer = subproblem_timer.elapsed();
+}
+
+/*!
+ *  \brief Solve a subproblem at x_cut and get its cost
+ *
+ *  With a loose tolerance, the right-hand side of the cut is lowered by the
+ * Lagrangian gap of the duals, so that the cut stays valid. When this bound
+ * is not finite, the subproblem is solved again exactly. A solve that is not
+ * optimal gets no correction, its status being reported as is.
+ */
+void BendersBase::SolveSubproblemAtXCut(
+    const std::shared_ptr<SubproblemWorker> &worker,
+    PlainData::SubProblemData &subproblem_data) {
   worker->fix_to(_data.x_cut);
+  if (_options.SUBPROBLEM_INITIAL_TOLERANCE > 0 || subproblem_tolerance_ > 0) {
+    // back to the solver's default once the tolerance is exact
+    worker->set_dual_tolerance(subproblem_tolerance_ > 0 ? subproblem_tolerance_
+                                                         : -1);
+  }
   worker->solve(subproblem_data.lpstatus, _options.OUTPUTROOT,
-                _options.LAST_MASTER_MPS + MPS_SUFFIX, _writer);
+                LastMasterFileName(), _writer);
   worker->get_value(subproblem_data.subproblem_cost);
+  subproblem_data.lagrangian_gap = 0;
+  if (subproblem_tolerance_ <= 0 ||
+      subproblem_data.lpstatus != SOLVER_STATUS::OPTIMAL) {
+    return;
+  }
+  worker->get_lagrangian_gap(subproblem_data.lagrangian_gap);
+  if (!std::isfinite(subproblem_data.lagrangian_gap)) {
+    worker->set_dual_tolerance(-1);
+    worker->solve(subproblem_data.lpstatus, _options.OUTPUTROOT,
+                  LastMasterFileName(), _writer);
+    worker->get_value(subproblem_data.subproblem_cost);
+    subproblem_data.lagrangian_gap = 0;
+  }
+}
 
-  worker->get_subgradient(subproblem_data.var_name_and_subgradient);
-  worker->get_splex_num_of_ite_last(subproblem_data.simplex_iter);
-  subproblem_data.subproblem_timer = subproblem_timer.elapsed();
+/*!
+ *  \brief Replace the cut of a subproblem solved at x_cut by a Pareto-optimal
+ * one
+ *
+ *  With PARETO_CUT_WEIGHT, the subproblem is solved again at x_cut moved
+ * toward the core point x_in by this weight. For a small weight, its duals
+ * are optimal at x_cut and, among those, the best at x_in (Magnanti-Wong, in
+ * the perturbed primal form of Sherali and Lunday). The cut computed at the
+ * moved point is valid whatever the weight; it is kept only if it is not
+ * weaker at x_cut, the cost at x_cut staying the one of the upper bound.
+ */
+void BendersBase::StrengthenSubproblemCut(
+    const std::shared_ptr<SubproblemWorker> &worker,
+    PlainData::SubProblemData &subproblem_data) {
+  if (_options.PARETO_CUT_WEIGHT <= 0 || _data.x_in.empty()) {
+    return;
+  }
+  Timer pareto_timer;
+  Point x_moved;
+  bool is_moved = false;
+  for (const auto &[name, value] : _data.x_cut) {
+    x_moved[name] = value;
+    if (const auto x_in = _data.x_in.find(name); x_in != _data.x_in.end()) {
+      x_moved[name] += _options.PARETO_CUT_WEIGHT * (x_in->second - value);
+    }
+    is_moved = is_moved || x_moved[name] != value;
+  }
+  if (!is_moved) {
+    return;
+  }
+
+  worker->fix_to(x_moved);
+  int lpstatus;
+  worker->solve(lpstatus, _options.OUTPUTROOT, LastMasterFileName(), _writer);
+  double cut_at_x_cut = 0;
+  double lagrangian_gap = 0;
+  if (lpstatus == SOLVER_STATUS::OPTIMAL) {
+    worker->get_value(cut_at_x_cut);
+    if (subproblem_tolerance_ > 0) {
+      worker->get_lagrangian_gap(lagrangian_gap);
+    }
+  }
+  if (lpstatus == SOLVER_STATUS::OPTIMAL && std::isfinite(lagrangian_gap)) {
+    Point subgradient;
+    worker->get_subgradient(subgradient);
+    cut_at_x_cut -= lagrangian_gap;
+    for (const auto &[name, value] : _data.x_cut) {
+      if (const auto s = subgradient.find(name); s != subgradient.end()) {
+        cut_at_x_cut += s->second * (value - x_moved[name]);
+      }
+    }
+    const double loss = subproblem_data.cut_rhs() - cut_at_x_cut;
+    if (loss <= PARETO_CUT_RELATIVE_LOSS *
+                    std::max(1., std::abs(subproblem_data.subproblem_cost))) {
+      subproblem_data.var_name_and_subgradient = std::move(subgradient);
+      subproblem_data.lagrangian_gap =
+          std::max(0., subproblem_data.subproblem_cost - cut_at_x_cut);
+    }
+  }
+  subproblem_data.pareto_timer = pareto_timer.elapsed();
 }
 
 /*!
@@ -418,25 +789,61 @@ void BendersBase::SolveSubproblem(
  * subproblem problem
  *
  */
+void compute_cut_val(const Point &var_name_subgradient, const Point &x_cut,
+                     Point &s) {
+  for (auto const &[cand_name, cand_value] : x_cut) {
+    const auto cand_name_and_subgradient = var_name_subgradient.find(cand_name);
+    if (cand_name_and_subgradient != var_name_subgradient.end()) {
+      s[cand_name] += cand_name_and_subgradient->second;
+    }
+  }
+}
+
 void BendersBase::compute_cut(const SubProblemDataMap &subproblem_data_map) {
+  if (!subproblem_clusters_.empty()) {
+    compute_cut_by_cluster(subproblem_data_map);
+    return;
+  }
   // current_outer_loop_criterion_ = 0.0;
   for (auto const &[subproblem_name, subproblem_data] : subproblem_data_map) {
     _data.ub += subproblem_data.subproblem_cost;
 
     _master->addSubproblemCut(_problem_to_id[subproblem_name],
                               subproblem_data.var_name_and_subgradient,
-                              _data.x_cut, subproblem_data.subproblem_cost);
+                              _data.x_cut, subproblem_data.cut_rhs());
     relevantIterationData_.last._cut_trace[subproblem_name] = subproblem_data;
   }
 }
 
-void compute_cut_val(const Point &var_name_subgradient, const Point &x_cut,
-                     Point &s) {
-  for (auto const &[cand_name, cand_value] : x_cut) {
-    const auto cand_name_and_subgradient = var_name_subgradient.find(cand_name);
-    if (cand_name_and_subgradient != var_name_subgradient.end()) {
-      s[cand_name] += cand_name_and_subgradient->second;
-    }
+/*!
+ *  \brief Add one cut per cluster of subproblems to the Master Problem
+ *
+ *  The cuts of the subproblems of a cluster are summed into a single cut on
+ * the alpha shared by the cluster
+ *
+ *  \param subproblem_data_map : cuts information of every subproblem
+ */
+void BendersBase::compute_cut_by_cluster(
+    const SubProblemDataMap &subproblem_data_map) {
+  struct ClusterCut {
+    int subproblem_id = 0;
+    Point s;
+    double rhs = 0;
+  };
+  std::map<int, ClusterCut> cluster_cuts;
+  for (auto const &[subproblem_name, subproblem_data] : subproblem_data_map) {
+    _data.ub += subproblem_data.subproblem_cost;
+
+    const int id = _problem_to_id[subproblem_name];
+    auto &cut = cluster_cuts[subproblem_clusters_[id]];
+    cut.subproblem_id = id;
+    cut.rhs += subproblem_data.cut_rhs();
+    compute_cut_val(subproblem_data.var_name_and_subgradient, _data.x_cut,
+                    cut.s);
+    relevantIterationData_.last._cut_trace[subproblem_name] = subproblem_data;
+  }
+  for (auto const &[cluster, cut] : cluster_cuts) {
+    _master->addSubproblemCut(cut.subproblem_id, cut.s, _data.x_cut, cut.rhs);
   }
 }
 
@@ -456,7 +863,7 @@ void BendersBase::compute_cut_aggregate(
   _data.ub = 0;
   for (auto const &[name, subproblem_data] : subproblem_data_map) {
     _data.ub += subproblem_data.subproblem_cost;
-    rhs += subproblem_data.subproblem_cost;
+    rhs += subproblem_data.cut_rhs();
 
     compute_cut_val(subproblem_data.var_name_and_subgradient, _data.x_cut, s);
 
@@ -474,6 +881,43 @@ void BendersBase::compute_cut_aggregate(
  */
 void BendersBase::BuildCutFull(const SubProblemDataMap &subproblem_data_map) {
   check_status(subproblem_data_map);
+  LogParetoCutsTimer(subproblem_data_map);
+  // value at x_out of the cuts computed at x_cut, against the master alphas,
+  // the alpha of a cluster being compared to the sum of its cuts
+  double cuts_at_x_out = 0;
+  double alphas = 0;
+  std::map<int, std::pair<double, double>> clusters_cut_and_alpha;
+  for (auto const &[name, subproblem_data] : subproblem_data_map) {
+    double cut_at_x_out = subproblem_data.cut_rhs();
+    for (auto const &[candidate, subgradient] :
+         subproblem_data.var_name_and_subgradient) {
+      if (const auto x_out = _data.x_out.find(candidate);
+          x_out != _data.x_out.end()) {
+        cut_at_x_out += subgradient * (x_out->second - _data.x_cut[candidate]);
+      }
+    }
+    const int id = _problem_to_id[name];
+    const double alpha = _data.single_subpb_costs_under_approx[id];
+    if (!subproblem_clusters_.empty()) {
+      auto &[cluster_cut, cluster_alpha] =
+          clusters_cut_and_alpha[subproblem_clusters_[id]];
+      cluster_cut += cut_at_x_out;
+      cluster_alpha = alpha;
+    } else if (!_options.AGGREGATION && cut_at_x_out > alpha) {
+      cuts_misprice_ = false;
+    }
+    cuts_at_x_out += cut_at_x_out;
+    alphas += alpha;
+  }
+  for (auto const &[cluster, cut_and_alpha] : clusters_cut_and_alpha) {
+    if (cut_and_alpha.first > cut_and_alpha.second) {
+      cuts_misprice_ = false;
+    }
+  }
+  if (_options.AGGREGATION && cuts_at_x_out > alphas) {
+    cuts_misprice_ = false;
+  }
+
   if (_options.AGGREGATION) {
     compute_cut_aggregate(subproblem_data_map);
   } else {
@@ -685,8 +1129,16 @@ std::filesystem::path BendersBase::get_master_path() const {
  *  \brief Get path to last mps file of master problem
  */
 std::filesystem::path BendersBase::LastMasterPath() const {
-  return std::filesystem::path(_options.OUTPUTROOT) /
-         (_options.LAST_MASTER_MPS + MPS_SUFFIX);
+  return std::filesystem::path(_options.OUTPUTROOT) / LastMasterFileName();
+}
+
+/*!
+ *  \brief Get name of the last mps file of master problem, compressed
+ * according to MPS_COMPRESSION
+ */
+std::string BendersBase::LastMasterFileName() const {
+  return _options.LAST_MASTER_MPS + MPS_SUFFIX +
+         compression_extension(compression_from_name(_options.MPS_COMPRESSION));
 }
 
 /*!
@@ -773,6 +1225,19 @@ void BendersBase::MatchProblemToId() {
     _problem_to_id[problem.first] = count;
     count++;
   }
+  subproblem_clusters_ = SubproblemClusters();
+}
+
+std::vector<int> BendersBase::SubproblemClusters() const {
+  if (_options.CUT_CLUSTERS <= 0 || _options.AGGREGATION) {
+    return {};
+  }
+  std::vector<std::string> names(_problem_to_id.size());
+  for (const auto &[name, id] : _problem_to_id) {
+    names[id] = name;
+  }
+  return ClusterSubproblems(names, _options.CUT_CLUSTERS,
+                            _options.CUT_CLUSTERING);
 }
 
 
@@ -790,6 +1255,8 @@ int BendersBase::get_log_level() const { return _options.LOG_LEVEL; }
 bool BendersBase::is_trace() const { return _options.TRACE; }
 Point BendersBase::get_x_cut() const { return _data.x_cut; }
 void BendersBase::set_x_cut(const Point &x_cut) { _data.x_cut = x_cut; }
+Point BendersBase::get_x_in() const { return _data.x_in; }
+void BendersBase::set_x_in(const Point &x_in) { _data.x_in = x_in; }
 Point BendersBase::get_x_out() const { return _data.x_out; }
 void BendersBase::set_x_out(const Point &x_out) { _data.x_out = x_out; }
 double BendersBase::get_timer_master() const { return _data.timer_master; }
@@ -939,7 +1406,8 @@ void BendersBase::ResetMasterFromLastIteration() {
   reset_master<WorkerMaster>(master_variable_map_, LastMasterPath(),
                                 get_solver_name(), get_log_level(),
                                 _data.nsubproblem, solver_log_manager_,
-                                IsResumeMode(), _logger);
+                                IsResumeMode(), _logger,
+                                MasterSubproblemClusters());
 }
 bool BendersBase::MasterIsEmpty() const { return master_is_empty_; }
 
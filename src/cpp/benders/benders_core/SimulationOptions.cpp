@@ -5,6 +5,8 @@
 #include <filesystem>
 
 #include "LogUtils.h"
+#include "multisolver_interface/ProblemFileCompression.h"
+#include "multisolver_interface/SolverAbstract.h"
 Json::Value SimulationOptions::get_value_from_json(
     const std::filesystem::path &file_name) {
   Json::Value _input;
@@ -137,6 +139,15 @@ BaseOptions SimulationOptions::get_base_options() const {
   result.SOLVER_NAME = SOLVER_NAME;
   result.weights = _weights;
   result.RESUME = RESUME;
+  try {
+    compression_from_name(MPS_COMPRESSION);
+  } catch (const InvalidSolverOptionException &) {
+    std::cerr << LOGLOCATION << "Invalid value " << MPS_COMPRESSION
+              << " for option MPS_COMPRESSION" << std::endl;
+    std::exit(1);
+  }
+  result.MPS_COMPRESSION = MPS_COMPRESSION;
+  result.RESOURCE_MONITOR_PERIOD = RESOURCE_MONITOR_PERIOD;
 
   return result;
 }
@@ -151,6 +162,10 @@ BendersBaseOptions SimulationOptions::get_benders_options() const {
   result.RELAXED_GAP = RELAXED_GAP;
   result.TIME_LIMIT = TIME_LIMIT;
   result.SEPARATION_PARAM = SEPARATION_PARAM;
+  result.ADAPTIVE_SEPARATION = ADAPTIVE_SEPARATION;
+  result.MASTER_INITIAL_RELATIVE_GAP = MASTER_INITIAL_RELATIVE_GAP;
+  result.SUBPROBLEM_INITIAL_TOLERANCE = SUBPROBLEM_INITIAL_TOLERANCE;
+  result.PARETO_CUT_WEIGHT = PARETO_CUT_WEIGHT;
 
   if (MASTER_FORMULATION == "integer") {
     result.MASTER_FORMULATION = MasterFormulation::INTEGER;
@@ -161,8 +176,39 @@ BendersBaseOptions SimulationOptions::get_benders_options() const {
               << " for option master" << std::endl;
     std::exit(1);
   }
+  result.SINGLE_TREE = SINGLE_TREE;
+
+  if (MASTER_STABILIZATION == "in-out") {
+    result.MASTER_STABILIZATION = MasterStabilization::IN_OUT;
+  } else if (MASTER_STABILIZATION == "level-bundle") {
+    result.MASTER_STABILIZATION = MasterStabilization::LEVEL_BUNDLE;
+  } else {
+    std::cerr << LOGLOCATION << "Invalid value " << MASTER_STABILIZATION
+              << " for option master_stabilization" << std::endl;
+    std::exit(1);
+  }
+  if (LEVEL_BUNDLE_NORM == "L1") {
+    result.LEVEL_BUNDLE_NORM = ProximalNorm::L1;
+  } else if (LEVEL_BUNDLE_NORM == "Linf") {
+    result.LEVEL_BUNDLE_NORM = ProximalNorm::LINF;
+  } else {
+    std::cerr << LOGLOCATION << "Invalid value " << LEVEL_BUNDLE_NORM
+              << " for option level_bundle_norm" << std::endl;
+    std::exit(1);
+  }
+  result.LEVEL_BUNDLE_PARAM = LEVEL_BUNDLE_PARAM;
 
   result.AGGREGATION = AGGREGATION;
+  result.CUT_CLUSTERS = CUT_CLUSTERS;
+  if (CUT_CLUSTERING == "year") {
+    result.CUT_CLUSTERING = SubproblemClustering::YEAR;
+  } else if (CUT_CLUSTERING == "week") {
+    result.CUT_CLUSTERING = SubproblemClustering::WEEK;
+  } else {
+    std::cerr << LOGLOCATION << "Invalid value " << CUT_CLUSTERING
+              << " for option cut_clustering" << std::endl;
+    std::exit(1);
+  }
   result.TRACE = TRACE;
   result.BOUND_ALPHA = BOUND_ALPHA;
 
@@ -170,6 +216,25 @@ BendersBaseOptions SimulationOptions::get_benders_options() const {
   result.LAST_MASTER_MPS = LAST_MASTER_MPS;
   result.LAST_MASTER_BASIS = LAST_MASTER_BASIS;
   result.BATCH_SIZE = BATCH_SIZE;
+  result.ADAPTIVE_BATCH_SIZE = ADAPTIVE_BATCH_SIZE;
+  if (BATCH_CONSTRUCTION == "consecutive") {
+    result.BATCH_CONSTRUCTION = BatchConstruction::CONSECUTIVE;
+  } else if (BATCH_CONSTRUCTION == "stratified") {
+    result.BATCH_CONSTRUCTION = BatchConstruction::STRATIFIED;
+  } else {
+    std::cerr << LOGLOCATION << "Invalid value " << BATCH_CONSTRUCTION
+              << " for option batch_construction" << std::endl;
+    std::exit(1);
+  }
+  if (BATCH_ORDER == "cyclic") {
+    result.BATCH_ORDER = BatchOrder::CYCLIC;
+  } else if (BATCH_ORDER == "priority") {
+    result.BATCH_ORDER = BatchOrder::PRIORITY;
+  } else {
+    std::cerr << LOGLOCATION << "Invalid value " << BATCH_ORDER
+              << " for option batch_order" << std::endl;
+    std::exit(1);
+  }
   result.EXTERNAL_LOOP_OPTIONS = GetExternalLoopOptions();
   return result;
 }
@@ -0,0 +1,66 @@
+#include "SubproblemClusters.h"
+
+#include <algorithm>
+#include <charconv>
+#include <string_view>
+#include <tuple>
+
+namespace {
+constexpr std::string_view PROBLEM_PREFIX = "problem-";
+
+// problem-<year>-<week>-..., false for the other names
+bool ParseYearAndWeek(std::string_view name, int &year, int &week) {
+  if (name.substr(0, PROBLEM_PREFIX.size()) != PROBLEM_PREFIX) {
+    return false;
+  }
+  const char *first = name.data() + PROBLEM_PREFIX.size();
+  const char *last = name.data() + name.size();
+  auto [year_end, year_ec] = std::from_chars(first, last, year);
+  if (year_ec != std::errc() || year_end == last || *year_end != '-') {
+    return false;
+  }
+  auto [week_end, week_ec] = std::from_chars(year_end + 1, last, week);
+  return week_ec == std::errc();
+}
+}  // namespace
+
+std::vector<int> OrderSubproblems(
+    const std::vector<std::string> &subproblem_names,
+    SubproblemClustering order) {
+  const int count = static_cast<int>(subproblem_names.size());
+  // (other name, major, minor, id)
+  std::vector<std::tuple<bool, int, int, int>> keys(count);
+  for (int id(0); id < count; ++id) {
+    int year = 0;
+    int week = 0;
+    const bool other_name = !ParseYearAndWeek(subproblem_names[id], year, week);
+    keys[id] = order == SubproblemClustering::YEAR
+                   ? std::make_tuple(other_name, year, week, id)
+                   : std::make_tuple(other_name, week, year, id);
+  }
+  std::sort(keys.begin(), keys.end());
+
+  std::vector<int> ids(count);
+  for (int position(0); position < count; ++position) {
+    ids[position] = std::get<3>(keys[position]);
+  }
+  return ids;
+}
+
+std::vector<int> ClusterSubproblems(
+    const std::vector<std::string> &subproblem_names, int number_of_clusters,
+    SubproblemClustering clustering) {
+  const int count = static_cast<int>(subproblem_names.size());
+  if (count == 0) {
+    return {};
+  }
+  number_of_clusters = std::clamp(number_of_clusters, 1, count);
+
+  const auto ids = OrderSubproblems(subproblem_names, clustering);
+  std::vector<int> clusters(count);
+  for (int position(0); position < count; ++position) {
+    clusters[ids[position]] = static_cast<int>(
+        static_cast<long long>(position) * number_of_clusters / count);
+  }
+  return clusters;
+}
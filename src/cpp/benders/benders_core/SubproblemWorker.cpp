@@ -1,5 +1,7 @@
 #include "SubproblemWorker.h"
 
+#include <limits>
+
 #include "solver_utils.h"
 
 /*!
@@ -81,4 +83,73 @@ void SubproblemWorker::get_solution(std::vector<double> &solution) const {
   } else {
     _solver->get_lp_sol(solution.data(), NULL, NULL);
   }
-}
\ No newline at end of file
+}
+
+/*!
+ *  \brief Set the reduced cost tolerance of the next solves
+ *
+ *  \param tolerance : largest reduced cost of the wrong sign accepted
+ */
+void SubproblemWorker::set_dual_tolerance(double tolerance) const {
+  _solver->set_dual_tolerance(tolerance);
+}
+
+/*!
+ *  \brief Gap between the cost of the last LP solution and the Lagrangian
+ * bound of its duals
+ *
+ *  The duals of a solve stopped at a loose reduced cost tolerance may have the
+ * wrong sign: the cost minus this gap is then a lower bound of the subproblem
+ * for every candidate, and the cut built on it stays valid. The gap is zero at
+ * an exact optimum, and infinite when a dual of the wrong sign is on an
+ * unbounded column or row.
+ *
+ *  \param gap : reference to the gap
+ */
+void SubproblemWorker::get_lagrangian_gap(double &gap) const {
+  constexpr double infinite_bound = 1e20;
+  const int ncols = _solver->get_ncols();
+  const int nrows = _solver->get_nrows();
+  std::vector<double> primals(ncols);
+  std::vector<double> duals(nrows);
+  std::vector<double> reduced_costs(ncols);
+  _solver->get_lp_sol(primals.data(), duals.data(), reduced_costs.data());
+
+  gap = 0;
+  const auto lb = _solver->get_lb_view();
+  const auto ub = _solver->get_ub_view();
+  for (int col(0); col < ncols; ++col) {
+    const double reduced_cost = reduced_costs[col];
+    if (reduced_cost == 0) {
+      continue;
+    }
+    const double bound = reduced_cost > 0 ? lb[col] : ub[col];
+    if (std::abs(bound) >= infinite_bound) {
+      gap = std::numeric_limits<double>::infinity();
+      return;
+    }
+    gap += reduced_cost * (primals[col] - bound);
+  }
+
+  std::vector<char> row_types(nrows);
+  std::vector<double> rhs(nrows);
+  solver_getrowtype(*_solver, row_types, 0, nrows - 1);
+  solver_getrhs(*_solver, rhs, 0, nrows - 1);
+  const auto rows = _solver->get_rows_view();
+  for (int row(0); row < nrows; ++row) {
+    if (duals[row] == 0 || row_types[row] == 'E') {
+      continue;
+    }
+    if ((row_types[row] == 'L' && duals[row] > 0) ||
+        (row_types[row] == 'G' && duals[row] < 0) ||
+        (row_types[row] != 'L' && row_types[row] != 'G')) {
+      gap = std::numeric_limits<double>::infinity();
+      return;
+    }
+    double activity = 0;
+    for (int k = rows.starts[row]; k < rows.starts[row + 1]; ++k) {
+      activity += rows.values[k] * primals[rows.indexes[k]];
+    }
+    gap += duals[row] * (activity - rhs[row]);
+  }
+}
@@ -1,5 +1,8 @@
 #include "WorkerMaster.h"
 
+#include <algorithm>
+#include <map>
+#include <numeric>
 
 #include "solver_utils.h"
 
@@ -18,14 +21,18 @@ WorkerMaster::WorkerMaster(Logger logger) : Worker(logger) {
  *  \param solver_name : solver name
  *  \param log_level : solver log level
  *  \param subproblems_count : number of subproblems
+ *  \param subproblem_clusters : cluster of each subproblem when the cuts are
+ * aggregated by cluster, empty otherwise
  */
 WorkerMaster::WorkerMaster(
     VariableMap const &variable_map, const std::filesystem::path &path_to_mps,
     const std::string &solver_name, const int log_level, int subproblems_count,
     SolverLogManager&solver_log_manager,
-    const bool mps_has_alpha, Logger logger)
+    const bool mps_has_alpha, Logger logger,
+    std::vector<int> subproblem_clusters)
     : Worker(std::move(logger)),
       subproblems_count(subproblems_count),
+      subproblem_clusters_(std::move(subproblem_clusters)),
       _mps_has_alpha(mps_has_alpha) {
   _is_master = true;
 
@@ -58,15 +65,150 @@ void WorkerMaster::get(Point &x_out, double &overall_subpb_cost_under_approx,
   } else {
     _solver->get_lp_sol(ptr.data(), nullptr, nullptr);
   }
-  assert(id_single_subpb_costs_under_approx_.back() + 1 == ptr.size());
+  assert(*std::max_element(id_single_subpb_costs_under_approx_.begin(),
+                           id_single_subpb_costs_under_approx_.end()) +
+             1 ==
+         ptr.size());
+  ReadPoint(ptr, x_out, overall_subpb_cost_under_approx,
+            single_subpb_costs_under_approx);
+}
+
+void WorkerMaster::ReadPoint(const std::vector<double> &solution, Point &x_out,
+                             double &overall_subpb_cost_under_approx,
+                             DblVector &single_subpb_costs_under_approx) const {
   for (auto const &kvp : _id_to_name) {
-    x_out[kvp.second] = ptr[kvp.first];
+    x_out[kvp.second] = solution[kvp.first];
   }
-  overall_subpb_cost_under_approx = ptr[_id_alpha];
+  overall_subpb_cost_under_approx = solution[_id_alpha];
+  single_subpb_costs_under_approx.resize(
+      id_single_subpb_costs_under_approx_.size());
   for (int i(0); i < id_single_subpb_costs_under_approx_.size(); ++i) {
     single_subpb_costs_under_approx[i] =
-        ptr[id_single_subpb_costs_under_approx_[i]];
+        solution[id_single_subpb_costs_under_approx_[i]];
+  }
+}
+
+/*!
+ *  \brief Project a point on the level set of the cut model
+ *
+ *  Solves min ||x - center|| subject to the cuts and to master objective <=
+ * level, the norm being written with distance columns so that the problem
+ * stays linear. The rows, columns and objective are restored afterwards.
+ *
+ *  \param center : stability center
+ *  \param level : bound on the master objective
+ *  \param norm : L1 (one distance per candidate) or Linf (a single distance)
+ *  \param point : solution of the projection, if optimal
+ *  \return solver status of the projection
+ */
+int WorkerMaster::SolveLevelProjection(Point const &center, double level,
+                                       ProximalNorm norm,
+                                       LevelPoint &point) const {
+  const int ncols = _solver->get_ncols();
+  const int nrows = _solver->get_nrows();
+  const auto obj_view = _solver->get_obj_view();
+  const std::vector<double> obj(obj_view.begin(), obj_view.end());
+
+  // master objective <= level
+  std::vector<int> mclind;
+  std::vector<double> matval;
+  for (int col(0); col < ncols; ++col) {
+    if (obj[col] != 0) {
+      mclind.push_back(col);
+      matval.push_back(obj[col]);
+    }
+  }
+  solver_addrows(*_solver, {'L'}, {level}, {}, {0, (int)mclind.size()}, mclind,
+                 matval);
+
+  const int ndistances =
+      norm == ProximalNorm::LINF ? 1 : static_cast<int>(_id_to_name.size());
+  StrVector distance_names(ndistances);
+  for (int i(0); i < ndistances; ++i) {
+    distance_names[i] = "level_distance_" + std::to_string(i);
+  }
+  solver_addcols(*_solver, DblVector(ndistances, 0.0),
+                 IntVector(ndistances, 0), IntVector(0, 0), DblVector(0, 0.0),
+                 DblVector(ndistances, 0.0), DblVector(ndistances, 1e20),
+                 CharVector(ndistances, 'C'), distance_names);
+
+  // x - distance <= center and -x - distance <= -center
+  std::vector<char> rowtype;
+  std::vector<double> rowrhs;
+  std::vector<int> mstart = {0};
+  mclind.clear();
+  matval.clear();
+  int distance = ncols;
+  for (auto const &[id, name] : _id_to_name) {
+    const double center_value = center.at(name);
+    for (const double sign : {1.0, -1.0}) {
+      rowtype.push_back('L');
+      rowrhs.push_back(sign * center_value);
+      mclind.insert(mclind.end(), {id, distance});
+      matval.insert(matval.end(), {sign, -1.0});
+      mstart.push_back(static_cast<int>(mclind.size()));
+    }
+    if (norm == ProximalNorm::L1) {
+      ++distance;
+    }
+  }
+  solver_addrows(*_solver, rowtype, rowrhs, {}, mstart, mclind, matval);
+
+  _solver->set_obj_to_zero();
+  IntVector distance_ids(ndistances);
+  std::iota(distance_ids.begin(), distance_ids.end(), ncols);
+  _solver->chg_obj(distance_ids, DblVector(ndistances, 1.0));
+
+  int status;
+  std::vector<double> solution(_solver->get_ncols());
+  if (_solver->get_n_integer_vars() > 0) {
+    status = _solver->solve_mip();
+    if (status == SOLVER_STATUS::OPTIMAL) {
+      _solver->get_mip_sol(solution.data());
+    }
+  } else {
+    status = _solver->solve_lp();
+    if (status == SOLVER_STATUS::OPTIMAL) {
+      _solver->get_lp_sol(solution.data(), nullptr, nullptr);
+    }
+  }
+  if (status == SOLVER_STATUS::OPTIMAL) {
+    ReadPoint(solution, point.x, point.overall_subpb_cost_under_approx,
+              point.single_subpb_costs_under_approx);
+    point.objective = 0;
+    for (int col(0); col < ncols; ++col) {
+      point.objective += obj[col] * solution[col];
+    }
+  }
+
+  _solver->del_rows(nrows, _solver->get_nrows() - 1);
+  _solver->del_cols(ncols, _solver->get_ncols() - 1);
+  _solver->set_obj(obj.data(), 0, ncols - 1);
+  return status;
+}
+
+/*!
+ *  \brief Give the next MIP solve a starting solution
+ *
+ *  Only the investment variables are given, the solver computes the others.
+ *
+ *  \param x : value of the investment variables
+ */
+void WorkerMaster::SetMipStart(Point const &x) const {
+  if (_solver->get_n_integer_vars() == 0) {
+    return;
   }
+  std::vector<int> mindex;
+  std::vector<double> values;
+  mindex.reserve(x.size());
+  values.reserve(x.size());
+  for (auto const &[name, value] : x) {
+    if (auto const it = _name_to_id.find(name); it != _name_to_id.end()) {
+      mindex.push_back(it->second);
+      values.push_back(value);
+    }
+  }
+  _solver->set_mip_start(mindex, values);
 }
 
 /*!
@@ -252,10 +394,8 @@ void WorkerMaster::_set_alpha_var() {
     if (_mps_has_alpha) {
       _id_alpha = _solver->get_col_index(alpha_str);
       for (int i(0); i < subproblems_count; ++i) {
-        std::stringstream buffer;
-        buffer << "alpha_" << i;
         id_single_subpb_costs_under_approx_[i] =
-            _solver->get_col_index(buffer.str());
+            _solver->get_col_index(AlphaName(i));
       }
     } else {
       double lb(-1e10); /*!< Lower Bound */
@@ -272,31 +412,32 @@ void WorkerMaster::_set_alpha_var() {
                     alpha_str)); /* Add variable overall_subpb_cost_under_approx
                                     and its parameters */
 
+      // one column per subproblem, or per cluster shared by its subproblems
+      std::vector<int> mclind = {_id_alpha};
+      std::map<std::string, int> alpha_columns;
       for (int i(0); i < subproblems_count; ++i) {
-        std::stringstream buffer;
-        buffer << "alpha_" << i;
+        const auto name = AlphaName(i);
+        if (const auto it = alpha_columns.find(name);
+            it != alpha_columns.end()) {
+          id_single_subpb_costs_under_approx_[i] = it->second;
+          continue;
+        }
         id_single_subpb_costs_under_approx_[i] = _solver->get_ncols();
+        alpha_columns.emplace(name, _solver->get_ncols());
+        mclind.push_back(_solver->get_ncols());
         solver_addcols(
             *_solver, DblVector(1, 0.0), IntVector(1, 0), IntVector(0, 0),
             DblVector(0, 0.0), DblVector(1, lb), DblVector(1, ub),
             CharVector(1, 'C'),
-            StrVector(
-                1,
-                buffer.str())); /* Add variable single_subpb_costs_under_approx
-                                   and its parameters */
+            StrVector(1, name)); /* Add variable single_subpb_costs_under_approx
+                                    and its parameters */
       }
 
       std::vector<char> rowtype = {'E'};
       std::vector<double> rowrhs = {0};
-      std::vector<int> mstart = {0, subproblems_count + 1};
-      std::vector<double> matval(subproblems_count + 1, 0);
-      std::vector<int> mclind(subproblems_count + 1);
-      mclind[0] = _id_alpha;
+      std::vector<int> mstart = {0, static_cast<int>(mclind.size())};
+      std::vector<double> matval(mclind.size(), -1);
       matval[0] = 1;
-      for (int i(0); i < subproblems_count; ++i) {
-        mclind[i + 1] = id_single_subpb_costs_under_approx_[i];
-        matval[i + 1] = -1;
-      }
 
       solver_addrows(*_solver, rowtype, rowrhs, {}, mstart, mclind, matval);
     }
@@ -305,6 +446,13 @@ void WorkerMaster::_set_alpha_var() {
   }
 }
 
+std::string WorkerMaster::AlphaName(int subproblem) const {
+  if (subproblem_clusters_.empty()) {
+    return "alpha_" + std::to_string(subproblem);
+  }
+  return "alpha_cluster_" + std::to_string(subproblem_clusters_[subproblem]);
+}
+
 /*!
  *  \brief Fix an upper bound and the variable overall_subpb_cost_under_approx
  * of a problem
@@ -2,6 +2,7 @@
 
 #include <execution>
 #include <filesystem>
+#include <functional>
 #include <optional>
 #include <regex>
 
@@ -67,6 +68,7 @@ class BendersBase {
   void MasterGetRowType(std::vector<char> &qrtype, int first, int last) const;
   void ResetMasterFromLastIteration();
   std::filesystem::path LastMasterPath() const;
+  std::string LastMasterFileName() const;
   bool MasterIsEmpty() const;
   void DoFreeProblems(bool free_problems) { free_problems_ = free_problems; }
   int MasterGetnrows() const;
@@ -127,6 +129,29 @@ class BendersBase {
   void ComputeInvestCost();
   virtual void compute_ub();
   virtual void get_master_value();
+  void SolveMasterSingleTree(const std::function<void()> &separate);
+  [[nodiscard]] std::vector<LazyConstraint> MasterRowsFrom(int first_row) const;
+  void UpdateMasterRelativeGap();
+  void UpdateSubproblemTolerance();
+  [[nodiscard]] double SubproblemTolerance() const {
+    return subproblem_tolerance_;
+  }
+  void SetSubproblemTolerance(double tolerance) {
+    subproblem_tolerance_ = tolerance;
+  }
+  void SolveSubproblemAtXCut(const std::shared_ptr<SubproblemWorker> &worker,
+                             PlainData::SubProblemData &subproblem_data);
+  void StrengthenSubproblemCut(const std::shared_ptr<SubproblemWorker> &worker,
+                               PlainData::SubProblemData &subproblem_data);
+  void LogParetoCutsTimer(const SubProblemDataMap &subproblem_data_map) const;
+  void ComputeLevelPoint();
+  void UpdateSeparationParam();
+  void UpdateSeparationParam(bool misprice, bool improving);
+  [[nodiscard]] virtual double LevelUpperBound() const {
+    return _data.best_ub;
+  }
+  [[nodiscard]] double LevelPointGap() const { return level_point_gap_; }
+  [[nodiscard]] bool IsMasterSolvedAtFinalGap() const;
   void GetSubproblemCut(SubProblemDataMap &subproblem_data_map);
   virtual void post_run_actions() const;
   void BuildCutFull(const SubProblemDataMap &subproblem_data_map);
@@ -152,6 +177,14 @@ class BendersBase {
   void AddSubproblem(const std::pair<std::string, VariableMap> &kvp);
   [[nodiscard]] virtual WorkerMasterPtr get_master() const;
   void MatchProblemToId();
+  /**
+   * cluster of each subproblem, by id, when the cuts are aggregated by
+   * clusters of subproblems, empty otherwise
+   */
+  [[nodiscard]] virtual std::vector<int> SubproblemClusters() const;
+  [[nodiscard]] std::vector<int> const &MasterSubproblemClusters() const {
+    return subproblem_clusters_;
+  }
   /**
    * for the nth variable name, Subproblems shares the same prefix , only the
    suffix is different
@@ -167,6 +200,8 @@ class BendersBase {
   [[nodiscard]] bool is_trace() const;
   [[nodiscard]] Point get_x_cut() const;
   void set_x_cut(const Point &x0);
+  [[nodiscard]] Point get_x_in() const;
+  void set_x_in(const Point &x0);
   [[nodiscard]] Point get_x_out() const;
   void set_x_out(const Point &x0);
   [[nodiscard]] double get_timer_master() const;
@@ -240,6 +275,7 @@ class BendersBase {
   [[nodiscard]] std::string status_from_criterion() const;
   void compute_cut_aggregate(const SubProblemDataMap &subproblem_data_map);
   void compute_cut(const SubProblemDataMap &subproblem_data_map);
+  void compute_cut_by_cluster(const SubProblemDataMap &subproblem_data_map);
   [[nodiscard]] std::map<std::string, int> get_master_variable_map(
       const std::map<std::string, std::map<std::string, int>> &input_map) const;
   [[nodiscard]] virtual bool shouldParallelize() const = 0;
@@ -254,6 +290,7 @@ class BendersBase {
   std::filesystem::path solver_log_file_ = "";
   WorkerMasterPtr _master;
   VariableMap _problem_to_id;
+  std::vector<int> subproblem_clusters_;
   StrVector subproblems;
   std::ofstream _csv_file;
   std::filesystem::path _csv_file_path;
@@ -262,6 +299,20 @@ class BendersBase {
   int cumulative_number_of_subproblem_resolved_before_resume = 0;
   Timer benders_timer;
   Output::SolutionData outer_loop_solution_data_;
+  // relative gap of the last master solve, 0 when solved to the solver's
+  // default gap or as an LP
+  double master_relative_gap_ = 0;
+  bool master_final_gap_required_ = false;
+  // reduced cost tolerance of the subproblem solves, 0 for the solver's
+  // default
+  double subproblem_tolerance_ = 0;
+  // SEPARATION_PARAM given by the user, value of an adaptive one after an
+  // improving step
+  double initial_separation_param_ = 1;
+  // no cut of the iteration separates the master solution
+  bool cuts_misprice_ = false;
+  // master objective at the level-bundle candidate minus the lower bound
+  double level_point_gap_ = 0;
 
  public:
   Logger _logger;
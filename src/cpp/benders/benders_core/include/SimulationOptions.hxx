@@ -16,12 +16,56 @@ BENDERS_OPTIONS_MACRO(RELAXED_GAP, double, 1e-5, asDouble())
 // In-out separation parameter
 BENDERS_OPTIONS_MACRO(SEPARATION_PARAM, double, 0.5, asDouble())
 
+// Relative gap of the first integer master solves, tightened as the Benders
+// gap closes down to RELATIVE_GAP. 0 to keep the solver's default gap
+BENDERS_OPTIONS_MACRO(MASTER_INITIAL_RELATIVE_GAP, double, 0, asDouble())
+
+// Reduced cost tolerance of the first subproblem solves, tightened as the
+// Benders gap closes, then the solver's default below 1e-6. 0 to always solve
+// the subproblems exactly
+BENDERS_OPTIONS_MACRO(SUBPROBLEM_INITIAL_TOLERANCE, double, 0, asDouble())
+
+// Weight of the stabilization center in a second subproblem solve, at x_cut
+// moved toward x_in by this weight, whose duals give a Pareto-optimal cut
+// (Magnanti-Wong). 0 to keep the duals of the solve at x_cut
+BENDERS_OPTIONS_MACRO(PARETO_CUT_WEIGHT, double, 0, asDouble())
+
+// True to adapt SEPARATION_PARAM along the iterations: the separation point
+// moves toward the master solution after a misprice and goes back to
+// SEPARATION_PARAM after an improving step
+BENDERS_OPTIONS_MACRO(ADAPTIVE_SEPARATION, bool, false, asBool())
+
+// Stabilization of the master candidates: in-out (SEPARATION_PARAM) or
+// level-bundle. SEPARATION_PARAM, ADAPTIVE_SEPARATION and the initial
+// relaxation of the in-out stabilization are not used with level-bundle
+BENDERS_OPTIONS_MACRO(MASTER_STABILIZATION, std::string, "in-out", asString())
+
+// Norm of the level-bundle projection, L1 or Linf
+BENDERS_OPTIONS_MACRO(LEVEL_BUNDLE_NORM, std::string, "Linf", asString())
+
+// Level-bundle level, from the lower bound (0) to the best upper bound (1)
+BENDERS_OPTIONS_MACRO(LEVEL_BUNDLE_PARAM, double, 0.5, asDouble())
+
 // Formulation of the master problem
 BENDERS_OPTIONS_MACRO(MASTER_FORMULATION, std::string, "integer", asString())
 
+// True to solve the integer master in a single branch and bound, the cuts of
+// the subproblems at its integer solutions being added as lazy constraints
+// (CBC only). False to solve the master again at each iteration. Ignored with
+// MAX_ITERATIONS or TIME_LIMIT, not checked inside the tree
+BENDERS_OPTIONS_MACRO(SINGLE_TREE, bool, false, asBool())
+
 // True if cuts need to be aggregated, false otherwise
 BENDERS_OPTIONS_MACRO(AGGREGATION, bool, false, asBool())
 
+// Number of clusters of subproblems sharing an alpha and a cut, 0 for one cut
+// per subproblem. Ignored with AGGREGATION
+BENDERS_OPTIONS_MACRO(CUT_CLUSTERS, int, 0, asInt())
+
+// Order of the subproblems split into clusters: year (MC year then week) or
+// week (week then MC year)
+BENDERS_OPTIONS_MACRO(CUT_CLUSTERING, std::string, "year", asString())
+
 // Path to the folder where output files should be printed
 BENDERS_OPTIONS_MACRO(OUTPUTROOT, std::string, ".", asString())
 
@@ -63,6 +107,13 @@ BENDERS_OPTIONS_MACRO(TIME_LIMIT, double, 1e12, asDouble())
 // LAST_MASTER_MPS
 BENDERS_OPTIONS_MACRO(LAST_MASTER_MPS, std::string, "master_last_iteration",
                       asString())
+
+// Compression of the mps files written by benders (none, gzip or zstd)
+BENDERS_OPTIONS_MACRO(MPS_COMPRESSION, std::string, "none", asString())
+// Seconds between two samples of the memory, cpu and disk usage, 0 to disable
+// them
+BENDERS_OPTIONS_MACRO(RESOURCE_MONITOR_PERIOD, double, 1, asDouble())
+
 // Resume last benders
 BENDERS_OPTIONS_MACRO(RESUME, bool, false, asBool())
 
@@ -73,6 +124,19 @@ BENDERS_OPTIONS_MACRO(LAST_MASTER_BASIS, std::string, "master_last_basis",
 // BATCH SIZE (Benders by batch)
 BENDERS_OPTIONS_MACRO(BATCH_SIZE, size_t, 0, asUInt())
 
+// True to grow or shrink the batch size between master iterations, from the
+// misprices and the batches needed to exhaust the gap (Benders by batch)
+BENDERS_OPTIONS_MACRO(ADAPTIVE_BATCH_SIZE, bool, false, asBool())
+
+// Subproblems of a batch: consecutive (in name order) or stratified (spread
+// over the weeks and MC years) (Benders by batch)
+BENDERS_OPTIONS_MACRO(BATCH_CONSTRUCTION, std::string, "consecutive",
+                      asString())
+
+// Order of the batches at each master iteration: cyclic, or priority (by
+// decreasing violation of their last cuts) (Benders by batch)
+BENDERS_OPTIONS_MACRO(BATCH_ORDER, std::string, "cyclic", asString())
+
 // is this an outer Loop
 BENDERS_OPTIONS_MACRO(DO_OUTER_LOOP, bool, false, asBool())
 
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "common.h"
+
+/*!
+ * \brief ids of the subproblems ordered by MC year then week (YEAR), or by
+ * week then MC year (WEEK), as read in names problem-<year>-<week>-..., the
+ * subproblems with other names coming last, by id
+ */
+std::vector<int> OrderSubproblems(
+    const std::vector<std::string> &subproblem_names,
+    SubproblemClustering order);
+
+/*!
+ * \brief cluster of each subproblem for the clustered aggregation of the cuts,
+ * subproblem_names being indexed by subproblem id
+ *
+ * The subproblems are ordered by OrderSubproblems and split into
+ * number_of_clusters groups of consecutive subproblems whose sizes differ by
+ * at most one.
+ */
+std::vector<int> ClusterSubproblems(
+    const std::vector<std::string> &subproblem_names, int number_of_clusters,
+    SubproblemClustering clustering);
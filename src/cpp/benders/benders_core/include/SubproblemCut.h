@@ -16,6 +16,16 @@ struct SubProblemData {
   double subproblem_timer;
   int simplex_iter;
   int lpstatus;
+  // cost minus the value of the cut at x_cut: Lagrangian bound of the duals
+  // of an inexact solve, loss of a Pareto-optimal cut
+  double lagrangian_gap = 0;
+  // time of the second solve giving a Pareto-optimal cut
+  double pareto_timer = 0;
+
+  // right-hand side of the cut, valid for every candidate
+  [[nodiscard]] double cut_rhs() const {
+    return subproblem_cost - lagrangian_gap;
+  }
   friend class boost::serialization::access;
   template <class Archive>
   void serialize(Archive &ar, const unsigned int version) {
@@ -26,6 +36,8 @@ struct SubProblemData {
     ar & subproblem_timer;
     ar & simplex_iter;
     ar & lpstatus;
+    ar & lagrangian_gap;
+    ar & pareto_timer;
   }
 };
 }  // namespace PlainData
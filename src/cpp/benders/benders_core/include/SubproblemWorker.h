@@ -28,4 +28,6 @@ class SubproblemWorker : public Worker {
   void fix_to(Point const &x0) const;
 
   void get_subgradient(Point &s) const;
+  void set_dual_tolerance(double tolerance) const;
+  void get_lagrangian_gap(double &gap) const;
 };
@@ -9,6 +9,18 @@
 class WorkerMaster;
 typedef std::shared_ptr<WorkerMaster> WorkerMasterPtr;
 
+/*!
+ * \brief point of the level set of the cut model returned by
+ * WorkerMaster::SolveLevelProjection
+ */
+struct LevelPoint {
+  Point x;
+  double overall_subpb_cost_under_approx = 0;
+  DblVector single_subpb_costs_under_approx;
+  // value of the master objective at this point
+  double objective = 0;
+};
+
 class WorkerMaster : public Worker {
  public:
   explicit WorkerMaster(Logger logger);
@@ -17,7 +29,8 @@ class WorkerMaster : public Worker {
                const std::string &solver_name, int log_level,
                int subproblems_count,
                SolverLogManager&solver_log_manager,
-               bool mps_has_alpha, Logger logger);
+               bool mps_has_alpha, Logger logger,
+               std::vector<int> subproblem_clusters = {});
   ~WorkerMaster() override = default;
 
   void get(Point &x0, double &overall_subpb_cost_under_approx,
@@ -33,6 +46,13 @@ class WorkerMaster : public Worker {
   void addSubproblemCut(int i, Point const &s, Point const &x0,
                         double const &rhs) const;
   void fix_alpha(double const &bestUB) const;
+  void SetMipStart(Point const &x) const;
+  void ReadPoint(const std::vector<double> &solution, Point &x_out,
+                 double &overall_subpb_cost_under_approx,
+                 DblVector &single_subpb_costs_under_approx) const;
+  [[nodiscard]] int SolveLevelProjection(Point const &center, double level,
+                                         ProximalNorm norm,
+                                         LevelPoint &point) const;
 
   virtual void DeactivateIntegrityConstraints() const;
   virtual void ActivateIntegrityConstraints() const;
@@ -43,6 +63,9 @@ class WorkerMaster : public Worker {
   std::vector<int> id_single_subpb_costs_under_approx_;
   int _id_alpha = 0;
   int subproblems_count;
+  // cluster of each subproblem, sharing one alpha, empty for one alpha per
+  // subproblem
+  std::vector<int> subproblem_clusters_;
   bool _mps_has_alpha = false;
   void define_matval_mclind(const Point &s, std::vector<double> &matval,
                             std::vector<int> &mclind) const;
@@ -59,5 +82,6 @@ class WorkerMaster : public Worker {
                                       std::vector<int> &mclind) const;
   void _set_upper_bounds() const;
   void _set_alpha_var();
+  [[nodiscard]] std::string AlphaName(int subproblem) const;
   void _set_nb_units_var_ids();
 };
@@ -24,6 +24,11 @@
 #include <vector>
 
 enum class MasterFormulation { INTEGER, RELAXED };
+enum class MasterStabilization { IN_OUT, LEVEL_BUNDLE };
+enum class ProximalNorm { L1, LINF };
+enum class SubproblemClustering { YEAR, WEEK };
+enum class BatchConstruction { CONSECUTIVE, STRATIFIED };
+enum class BatchOrder { CYCLIC, PRIORITY };
 enum class SOLVER { BENDERS, OUTER_LOOP, MERGE_MPS };
 
 struct Predicate;
@@ -133,10 +138,12 @@ struct BaseOptions {
   std::string MASTER_NAME;
   std::string SOLVER_NAME;
   std::string SLAVE_WEIGHT;
+  std::string MPS_COMPRESSION;
 
   int LOG_LEVEL = 0;
 
   double SLAVE_WEIGHT_VALUE = 0;
+  double RESOURCE_MONITOR_PERIOD = 1;
   bool RESUME = false;
 
   Str2Dbl weights;
@@ -159,18 +166,31 @@ struct BendersBaseOptions : public BaseOptions {
   double RELAXED_GAP = 0;
   double TIME_LIMIT = 0;
   double SEPARATION_PARAM = 1;
+  double MASTER_INITIAL_RELATIVE_GAP = 0;
+  double SUBPROBLEM_INITIAL_TOLERANCE = 0;
+  double PARETO_CUT_WEIGHT = 0;
 
+  bool ADAPTIVE_SEPARATION = false;
   bool AGGREGATION = false;
+  int CUT_CLUSTERS = 0;
+  SubproblemClustering CUT_CLUSTERING = SubproblemClustering::YEAR;
   bool TRACE = false;
   bool BOUND_ALPHA = false;
 
   MasterFormulation MASTER_FORMULATION;
+  bool SINGLE_TREE = false;
+  MasterStabilization MASTER_STABILIZATION = MasterStabilization::IN_OUT;
+  ProximalNorm LEVEL_BUNDLE_NORM = ProximalNorm::LINF;
+  double LEVEL_BUNDLE_PARAM = 0.5;
 
   std::string CSV_NAME;
   std::string LAST_MASTER_MPS;
   std::string LAST_MASTER_BASIS;
 
   size_t BATCH_SIZE;
+  bool ADAPTIVE_BATCH_SIZE = false;
+  BatchConstruction BATCH_CONSTRUCTION = BatchConstruction::CONSECUTIVE;
+  BatchOrder BATCH_ORDER = BatchOrder::CYCLIC;
   ExternalLoopOptions EXTERNAL_LOOP_OPTIONS;
 };
 
@@ -2,9 +2,9 @@
 #include "BendersMPI.h"
 
 #include <algorithm>
+#include <sstream>
 #include <utility>
 
-#include "include/memory.h"
 #include "CriterionComputation.h"
 #include "Timer.h"
 
@@ -14,7 +14,10 @@ BendersMpi::BendersMpi(BendersBaseOptions const &options, Logger logger,
                        std::shared_ptr<MathLoggerDriver> mathLoggerDriver)
     : BendersBase(options, logger, std::move(writer), mathLoggerDriver),
       _world(world),
-      _env(env) {}
+      _env(env),
+      // a single process walks the output directory
+      resource_monitor_(options.RESOURCE_MONITOR_PERIOD,
+                        world.rank() == 0 ? options.OUTPUTROOT : "") {}
 
 /*!
  *  \brief Method to load each problem in a thread
@@ -48,7 +51,8 @@ void BendersMpi::BuildMasterProblem() {
     reset_master<WorkerMaster>(master_variable_map_, get_master_path(),
                                   get_solver_name(), get_log_level(),
                                   _data.nsubproblem, solver_log_manager_,
-                                  IsResumeMode(), _logger);
+                                  IsResumeMode(), _logger,
+                                  MasterSubproblemClusters());
   }
 }
 /*!
@@ -86,6 +90,16 @@ void BendersMpi::BroadcastXCut() {
     Point x_cut = get_x_cut();
     mpi::broadcast(_world, x_cut, rank_0);
     set_x_cut(x_cut);
+    // the subproblems are solved at x_cut with the tolerance of the iteration
+    double subproblem_tolerance = SubproblemTolerance();
+    mpi::broadcast(_world, subproblem_tolerance, rank_0);
+    SetSubproblemTolerance(subproblem_tolerance);
+    // x_in is the core point of the Pareto-optimal cuts
+    if (Options().PARETO_CUT_WEIGHT > 0) {
+      Point x_in = get_x_in();
+      mpi::broadcast(_world, x_in, rank_0);
+      set_x_in(x_in);
+    }
   }
 }
 
@@ -188,9 +202,13 @@ void BendersMpi::master_build_cuts(
 
   _data.ub = 0;
 
-  for (const auto &subproblem_data_map : gathered_subproblem_map) {
-    BuildCutFull(subproblem_data_map);
+  // a single map, for the aggregated and clustered cuts to cover the
+  // subproblems of every process
+  SubProblemDataMap subproblem_data_map;
+  for (auto &process_subproblem_data_map : gathered_subproblem_map) {
+    subproblem_data_map.merge(process_subproblem_data_map);
   }
+  BuildCutFull(subproblem_data_map);
 
   _logger->LogSubproblemsSolvingCumulativeCpuTime(
       GetSubproblemsCumulativeCpuTime());
@@ -222,6 +240,7 @@ void BendersMpi::step_4_update_best_solution(int rank) {
   if (rank == rank_0) {
     compute_ub();
     update_best_ub();
+    UpdateSeparationParam();
     _logger->log_at_iteration_end(bendersDataToLogData(_data));
 
     UpdateTrace();
@@ -244,38 +263,12 @@ void BendersMpi::free() {
   _world.barrier();
 }
 
-namespace {
-struct self_mem {
-  long double vm_usage = 0.0;
-  long resident_set = 0.0;
-};
-self_mem process_mem_usage() {
-  self_mem mem;
-
-  // the two fields we want
-  unsigned long vsize;
-  long rss;
-  {
-    std::string ignore;
-    std::ifstream ifs("/proc/self/stat", std::ios_base::in);
-    ifs >> ignore >> ignore >> ignore >> ignore >> ignore >> ignore >> ignore >>
-        ignore >> ignore >> ignore >> ignore >> ignore >> ignore >> ignore >>
-        ignore >> ignore >> ignore >> ignore >> ignore >> ignore >> ignore >>
-        ignore >> vsize >> rss;
-  }
-
-  long page_size_kb = sysconf(_SC_PAGE_SIZE) /
-                      1024;  // in case x86-64 is configured to use 2MB pages
-  return {vsize / 1024.0l / 1024.l, rss * page_size_kb};
-}
-}
 void BendersMpi::memory() {
-  auto [dispo, total] = Memory::MemoryUsageGo();
-  auto [vm, rss] = process_mem_usage();
-  _logger->display_message("Memory usage: " + std::to_string(dispo) + "/" +
-                           std::to_string(total));
-  _logger->display_message("VM: " + std::to_string(vm) + "Mb; RSS: " +
-                           std::to_string(rss));
+  if (resource_monitor_.enabled()) {
+    std::ostringstream sample;
+    sample << resource_monitor_.latest();
+    _logger->display_message(sample.str());
+  }
 }
 
 
@@ -294,6 +287,10 @@ void BendersMpi::Run() {
   }
   _data.number_of_subproblem_solved = _data.nsubproblem;
   while (!_data.stop) {
+    if (single_tree_ && !_data.is_in_initial_relaxation) {
+      RunSingleTree();
+      break;
+    }
     memory();
     ++_data.it;
     ResetSimplexIterationsBounds();
@@ -351,6 +348,97 @@ void BendersMpi::PreRunInitialization() {
   }
   mathLoggerDriver_->write_header();
   init_data_ = false;
+
+  single_tree_ = false;
+  if (_world.rank() == rank_0 && Options().SINGLE_TREE &&
+      Options().MASTER_FORMULATION == MasterFormulation::INTEGER) {
+    single_tree_ = true;
+    try {
+      get_master()->_solver->set_lazy_constraint_callback(nullptr);
+    } catch (const NotImplementedFeatureSolverException &ex) {
+      single_tree_ = false;
+      _logger->display_message(std::string(ex.what()) +
+                               ", the master is solved at each iteration");
+    }
+    // 1e12 is the default TIME_LIMIT, no limit
+    if (single_tree_ &&
+        (Options().MAX_ITERATIONS != -1 || Options().TIME_LIMIT < 1e12)) {
+      single_tree_ = false;
+      _logger->display_message(
+          "MAX_ITERATIONS and TIME_LIMIT are not checked in a single tree, "
+          "the master is solved at each iteration");
+    }
+  }
+  BroadCast(single_tree_, rank_0);
+}
+
+/*!
+ *  \brief Run Benders in a single branch and bound of the integer master
+ *
+ *  Rank 0 solves the master once, each integer solution of the tree being an
+ * iteration run by every process. The other processes run iterations until
+ * rank 0 broadcasts the end of the tree. The stopping criteria are not
+ * checked during the tree, which stops at the final gap: it is not used with
+ * MAX_ITERATIONS or TIME_LIMIT.
+ */
+void BendersMpi::RunSingleTree() {
+  bool end_of_tree = false;
+  if (_world.rank() == rank_0) {
+    try {
+      SolveMasterSingleTree([this] { SingleTreeIteration(); });
+      _logger->log_master_solving_duration(get_timer_master());
+    } catch (std::exception const &ex) {
+      write_exception_message(ex);
+    }
+    end_of_tree = true;
+    // the other processes have left the tree after a failure of theirs
+    if (!exception_raised_) {
+      BroadCast(end_of_tree, rank_0);
+    }
+    ShouldBendersStop();
+    mathLoggerDriver_->Print(_data);
+    SaveCurrentBendersData();
+  } else {
+    while (!exception_raised_) {
+      BroadCast(end_of_tree, rank_0);
+      if (end_of_tree) {
+        break;
+      }
+      SingleTreeIteration();
+    }
+  }
+  _data.stop = true;
+}
+
+/*!
+ *  \brief Iteration at an integer solution of the master tree: the
+ * subproblems are solved at x_cut, set by rank 0, and their cuts added to the
+ * master
+ */
+void BendersMpi::SingleTreeIteration() {
+  ++_data.it;
+  if (_world.rank() == rank_0) {
+    bool end_of_tree = false;
+    BroadCast(end_of_tree, rank_0);
+    _logger->log_at_initialization(_data.it + GetNumIterationsBeforeRestart());
+    _logger->log_iteration_candidates(bendersDataToLogData(_data));
+  }
+  memory();
+  ResetSimplexIterationsBounds();
+  BroadcastXCut();
+  step_2_solve_subproblems_and_build_cuts();
+  if (exception_raised_) {
+    if (_world.rank() == rank_0) {
+      throw std::runtime_error(LOGLOCATION +
+                               "Subproblems failure in the master tree");
+    }
+    return;
+  }
+  step_4_update_best_solution(_world.rank());
+  if (_world.rank() == rank_0) {
+    mathLoggerDriver_->Print(_data);
+    SaveCurrentBendersData();
+  }
 }
 
 void BendersMpi::launch() {
@@ -5,6 +5,7 @@
 #include "BendersStructsDatas.h"
 #include "ILogger.h"
 #include "LoggerUtils.h"
+#include "ResourceMonitor.h"
 #include "SubproblemCut.h"
 #include "SubproblemWorker.h"
 #include "Timer.h"
@@ -39,6 +40,8 @@ class BendersMpi : public BendersBase {
   void step_1_solve_master();
   void step_2_solve_subproblems_and_build_cuts();
   void step_4_update_best_solution(int rank);
+  void RunSingleTree();
+  void SingleTreeIteration();
 
   void master_build_cuts(
       std::vector<SubProblemDataMap> gathered_subproblem_map);
@@ -57,7 +60,12 @@ class BendersMpi : public BendersBase {
   void check_if_some_proc_had_a_failure(int success);
 
   mpi::environment &_env;
+  ResourceMonitor resource_monitor_;
+  // integer master solved in a single branch and bound, once out of the
+  // initial relaxation
+  bool single_tree_ = false;
 
+  // logs the latest sample of the resource monitor
   void memory();
 
  protected:
@@ -29,7 +29,8 @@ void BendersSequential::InitializeProblems() {
   reset_master<WorkerMaster>(master_variable_map_, get_master_path(),
                                 get_solver_name(), get_log_level(),
                                 _data.nsubproblem, solver_log_manager_,
-                                IsResumeMode(), _logger);
+                                IsResumeMode(), _logger,
+                                MasterSubproblemClusters());
   for (const auto &problem : coupling_map_) {
     const auto subProblemFilePath = GetSubproblemPath(problem.first);
 
@@ -111,6 +112,7 @@ void BendersSequential::Run() {
 
     compute_ub();
     update_best_ub();
+    UpdateSeparationParam();
 
     _logger->log_at_iteration_end(bendersDataToLogData(_data));
 
@@ -5,6 +5,7 @@
 #include "ArchiveReader.h"
 #include "LogUtils.h"
 #include "Timer.h"
+#include "multisolver_interface/ProblemFileCompression.h"
 
 MergeMPS::MergeMPS(const MergeMPSOptions &options, Logger &logger,
                    Writer writer)
@@ -31,29 +32,16 @@ void MergeMPS::launch() {
     SolverAbstract::Ptr solver_l = factory.create_solver(solver_to_use);
     solver_l->set_output_log_level(_options.LOG_LEVEL);
 
+    solver_l->read_prob_mps(problem_name, false);
+    double objective_weight = 1.0;
     if (kvp.first != _options.MASTER_NAME) {
-      solver_l->read_prob_mps(problem_name, false);
       std::filesystem::remove(problem_name);
-      int mps_ncols(solver_l->get_ncols());
-
-      DblVector o(mps_ncols);
-      IntVector sequence(mps_ncols);
-      for (int i(0); i < mps_ncols; ++i) {
-        sequence[i] = i;
-      }
-      solver_get_obj_func_coeffs(*solver_l, o, 0, mps_ncols - 1);
-      double const weigth = slave_weight(nslaves, kvp.first);
-      for (auto &c : o) {
-        c *= weigth;
-      }
-      solver_l->chg_obj(sequence, o);
-    } else {
-      solver_l->read_prob_mps(problem_name, false);
+      objective_weight = slave_weight(nslaves, kvp.first);
     }
     StandardLp lpData(*solver_l);
     std::string varPrefix_l = "prob" + std::to_string(cntProblems_l) + "_";
 
-    lpData.append_in(mergedSolver_l, varPrefix_l);
+    lpData.append_in(mergedSolver_l, varPrefix_l, objective_weight);
 
     for (auto const &x : kvp.second) {
       int col_index = mergedSolver_l->get_col_index(varPrefix_l + x.first);
@@ -126,8 +114,10 @@ void MergeMPS::launch() {
 
   _logger->display_message("Problems merged.");
   _logger->display_message("Writing mps file");
-  mergedSolver_l->write_prob_mps(std::filesystem::path(_options.OUTPUTROOT) /
-                                 ("log_merged" + MPS_SUFFIX));
+  mergedSolver_l->write_prob_mps(
+      std::filesystem::path(_options.OUTPUTROOT) /
+      ("log_merged" + MPS_SUFFIX +
+       compression_extension(compression_from_name(_options.MPS_COMPRESSION))));
   _logger->display_message("Writing lp file");
   mergedSolver_l->write_prob_lp(std::filesystem::path(_options.OUTPUTROOT) /
                                 "log_merged.lp");
@@ -154,8 +144,7 @@ void MergeMPS::launch() {
     mergedSolver_l->get_lp_sol(ptr.data(), nullptr, nullptr);
   }
 
-  std::vector<double> obj_coef(mergedSolver_l->get_ncols());
-  mergedSolver_l->get_obj(obj_coef.data(), 0, mergedSolver_l->get_ncols() - 1);
+  const auto obj_coef = mergedSolver_l->get_obj_view();
   for (auto const &pairNameId : input[_options.MASTER_NAME]) {
     int varIndexInMerged_l = x_mps_id[pairNameId.first][_options.MASTER_NAME];
     x0[pairNameId.first] = ptr[varIndexInMerged_l];
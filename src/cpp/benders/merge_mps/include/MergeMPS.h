@@ -1,232 +1,106 @@
 #pragma once
 
+#include <numeric>
+
 #include "WriterFactories.h"
 #include "common.h"
 #include "logger/User.h"
 #include "solver_utils.h"
 
-enum Attribute {
-  INT_VALUE,
-  INT_VECTOR,
-  CHAR_VECTOR,
-  DBL_VECTOR,
-  MAX_ATTRIBUTE
-};
-
-enum IntAttribute { NROWS, NCOLS, NELES, MAX_INT_ATTRIBUTE };
-
-enum IntVectorAttribute {
-  MSTART,
-  MINDEX,
-  MAX_INT_VECTOR_ATTRIBUTE,
-};
-enum CharVectorAttribute { ROWTYPE, COLTYPE, MAX_CHAR_VECTOR_ATTRIBUTE };
-
-enum DblVectorAttribute {
-  MVALUE,
-  RHS,
-  RANGE,
-  OBJ,
-  LB,
-  UB,
-  MAX_DBL_VECTOR_ATTRIBUTE
-};
-typedef std::tuple<IntVector, std::vector<IntVector>, std::vector<CharVector>,
-                   std::vector<DblVector>>
-    raw_standard_lp_data;
-
+/*!
+ *  \brief problem to append to another one. Its matrix, objective and bounds
+ * are read through views on the solver, which must outlive this object and
+ * stay unchanged meanwhile.
+ */
 class StandardLp {
  private:
   std::vector<std::string> _colNames;
+  SparseMatrixView _rows;
+  ArrayView<double> _obj;
+  ArrayView<double> _lb;
+  ArrayView<double> _ub;
+  CharVector _rowTypes;
+  CharVector _colTypes;
+  DblVector _rhs;
 
  public:
-  // to be used in boost serialization for mpi transfer
-  raw_standard_lp_data _data;
   static size_t appendCNT;
 
  public:
-  void init() {
-    initialise_int_values_with_zeros();
-    initialise_int_vectors();
-    initialise_char_vectors();
-    initialise_dbl_vectors();
-  }
-
-  explicit StandardLp(SolverAbstract &solver_p) {
-    init();
-
-    int ncols = solver_p.get_ncols();
-    int nrows = solver_p.get_nrows();
-    int nelems = solver_p.get_nelems();
-
-    std::get<Attribute::INT_VALUE>(_data)[IntAttribute::NCOLS] = ncols;
-    std::get<Attribute::INT_VALUE>(_data)[IntAttribute::NROWS] = nrows;
-    std::get<Attribute::INT_VALUE>(_data)[IntAttribute::NELES] = nelems;
-
-    _colNames = solver_p.get_col_names();
-
-    std::get<Attribute::INT_VECTOR>(_data)[IntVectorAttribute::MSTART].clear();
-    std::get<Attribute::INT_VECTOR>(_data)[IntVectorAttribute::MSTART].resize(
-        nrows + 1);
-
-    std::get<Attribute::INT_VECTOR>(_data)[IntVectorAttribute::MINDEX].clear();
-    std::get<Attribute::INT_VECTOR>(_data)[IntVectorAttribute::MINDEX].resize(
-        nelems);
-
-    std::get<Attribute::CHAR_VECTOR>(_data)[CharVectorAttribute::COLTYPE]
-        .clear();
-    std::get<Attribute::CHAR_VECTOR>(_data)[CharVectorAttribute::COLTYPE]
-        .resize(ncols);
-
-    std::get<Attribute::CHAR_VECTOR>(_data)[CharVectorAttribute::ROWTYPE]
-        .clear();
-    std::get<Attribute::CHAR_VECTOR>(_data)[CharVectorAttribute::ROWTYPE]
-        .resize(nrows);
-
-    std::get<Attribute::DBL_VECTOR>(_data)[DblVectorAttribute::MVALUE].clear();
-    std::get<Attribute::DBL_VECTOR>(_data)[DblVectorAttribute::MVALUE].resize(
-        nelems);
-
-    std::get<Attribute::DBL_VECTOR>(_data)[DblVectorAttribute::RHS].clear();
-    std::get<Attribute::DBL_VECTOR>(_data)[DblVectorAttribute::RHS].resize(
-        nrows);
-
-    // Range constraint don't exist in a sparse matrix formulation
-    std::get<Attribute::DBL_VECTOR>(_data)[DblVectorAttribute::RANGE].clear();
-    std::get<Attribute::DBL_VECTOR>(_data)[DblVectorAttribute::RANGE].resize(
-        nrows);
-
-    std::get<Attribute::DBL_VECTOR>(_data)[DblVectorAttribute::OBJ].clear();
-    std::get<Attribute::DBL_VECTOR>(_data)[DblVectorAttribute::OBJ].resize(
-        ncols);
-
-    std::get<Attribute::DBL_VECTOR>(_data)[DblVectorAttribute::LB].clear();
-    std::get<Attribute::DBL_VECTOR>(_data)[DblVectorAttribute::LB].resize(
-        ncols);
-
-    std::get<Attribute::DBL_VECTOR>(_data)[DblVectorAttribute::UB].clear();
-    std::get<Attribute::DBL_VECTOR>(_data)[DblVectorAttribute::UB].resize(
-        ncols);
-
-    solver_getrows(
-        solver_p,
-        std::get<Attribute::INT_VECTOR>(_data)[IntVectorAttribute::MSTART],
-        std::get<Attribute::INT_VECTOR>(_data)[IntVectorAttribute::MINDEX],
-        std::get<Attribute::DBL_VECTOR>(_data)[DblVectorAttribute::MVALUE], 0,
-        std::get<Attribute::INT_VALUE>(_data)[IntAttribute::NROWS] - 1);
-
-    solver_getrowtype(
-        solver_p,
-        std::get<Attribute::CHAR_VECTOR>(_data)[CharVectorAttribute::ROWTYPE],
-        0, std::get<Attribute::INT_VALUE>(_data)[IntAttribute::NROWS] - 1);
-
-    solver_getrhs(
-        solver_p,
-        std::get<Attribute::DBL_VECTOR>(_data)[DblVectorAttribute::RHS], 0,
-        std::get<Attribute::INT_VALUE>(_data)[IntAttribute::NROWS] - 1);
-
-    solver_getcolinfo(
-        solver_p,
-        std::get<Attribute::CHAR_VECTOR>(_data)[CharVectorAttribute::COLTYPE],
-        std::get<Attribute::DBL_VECTOR>(_data)[DblVectorAttribute::LB],
-        std::get<Attribute::DBL_VECTOR>(_data)[DblVectorAttribute::UB], 0,
-        std::get<Attribute::INT_VALUE>(_data)[IntAttribute::NCOLS] - 1);
-
-    solver_get_obj_func_coeffs(
-        solver_p,
-        std::get<Attribute::DBL_VECTOR>(_data)[DblVectorAttribute::OBJ], 0,
-        std::get<Attribute::INT_VALUE>(_data)[IntAttribute::NCOLS] - 1);
-
-    assert(std::get<Attribute::INT_VECTOR>(_data)[IntVectorAttribute::MSTART]
-               .size() ==
-           1 + std::get<Attribute::INT_VALUE>(_data)[IntAttribute::NROWS]);
-
-    assert(std::get<Attribute::CHAR_VECTOR>(_data)[CharVectorAttribute::COLTYPE]
-               .size() ==
-           std::get<Attribute::INT_VALUE>(_data)[IntAttribute::NCOLS]);
-    assert(std::get<Attribute::CHAR_VECTOR>(_data)[CharVectorAttribute::ROWTYPE]
-               .size() ==
-           std::get<Attribute::INT_VALUE>(_data)[IntAttribute::NROWS]);
-
-    assert(std::get<Attribute::DBL_VECTOR>(_data)[DblVectorAttribute::MVALUE]
-               .size() ==
-           std::get<Attribute::INT_VALUE>(_data)[IntAttribute::NELES]);
-    assert(std::get<Attribute::DBL_VECTOR>(_data)[DblVectorAttribute::RHS]
-               .size() ==
-           std::get<Attribute::INT_VALUE>(_data)[IntAttribute::NROWS]);
+  explicit StandardLp(SolverAbstract &solver_p)
+      : _colNames(solver_p.get_col_names()),
+        _rows(solver_p.get_rows_view()),
+        _obj(solver_p.get_obj_view()),
+        _lb(solver_p.get_lb_view()),
+        _ub(solver_p.get_ub_view()),
+        _rowTypes(solver_p.get_nrows()),
+        _colTypes(solver_p.get_ncols()),
+        _rhs(solver_p.get_nrows()) {
+    const int ncols = solver_p.get_ncols();
+    const int nrows = solver_p.get_nrows();
+    solver_getrowtype(solver_p, _rowTypes, 0, nrows - 1);
+    solver_getrhs(solver_p, _rhs, 0, nrows - 1);
+    if (ncols > 0) {
+      solver_p.get_col_type(_colTypes.data(), 0, ncols - 1);
+    }
 
-    assert(std::get<Attribute::DBL_VECTOR>(_data)[DblVectorAttribute::OBJ]
-               .size() ==
-           std::get<Attribute::INT_VALUE>(_data)[IntAttribute::NCOLS]);
-    assert(
-        std::get<Attribute::DBL_VECTOR>(_data)[DblVectorAttribute::LB].size() ==
-        std::get<Attribute::INT_VALUE>(_data)[IntAttribute::NCOLS]);
-    assert(
-        std::get<Attribute::DBL_VECTOR>(_data)[DblVectorAttribute::UB].size() ==
-        std::get<Attribute::INT_VALUE>(_data)[IntAttribute::NCOLS]);
+    assert(_rows.number_of_vectors() == nrows);
+    assert(_rows.number_of_elements() == solver_p.get_nelems());
+    assert(_obj.size() == static_cast<size_t>(ncols));
+    assert(_lb.size() == static_cast<size_t>(ncols));
+    assert(_ub.size() == static_cast<size_t>(ncols));
   }
 
+  /*!
+   *  \brief appends the columns, renamed with the prefix, and the rows of the
+   * problem, the objective being multiplied by objective_weight. Returns the
+   * index of the first appended column.
+   */
   int append_in(SolverAbstract::Ptr containingSolver_p,
-                std::string const &prefix_p = "") const {
-    // simply increment the columns indices
-    IntVector newmindex(
-        std::get<Attribute::INT_VECTOR>(_data)[IntVectorAttribute::MINDEX]);
-    int nbExistingCols(containingSolver_p->get_ncols());
-    for (auto &i : newmindex) {
-      i += nbExistingCols;
-    }
+                std::string const &prefix_p = "",
+                double objective_weight = 1.0) const {
+    const int nbExistingCols(containingSolver_p->get_ncols());
+    const int ncols = static_cast<int>(_colTypes.size());
 
     // rename variables
     std::string prefix_l =
         (prefix_p != "") ? prefix_p : ("prob" + std::to_string(appendCNT));
-    std::vector<std::string> newNames;
-    newNames.resize(_colNames.size());
-    std::transform(_colNames.begin(), _colNames.end(), newNames.begin(),
-                   [&prefix_l](std::string varName_p) -> std::string {
-                     return prefix_l + varName_p;
-                   });
 
-    std::vector<int> mstart(
-        std::get<Attribute::INT_VALUE>(_data)[IntAttribute::NCOLS], 0);
-    solver_addcols(
-        *containingSolver_p,
-        std::get<Attribute::DBL_VECTOR>(_data)[DblVectorAttribute::OBJ], mstart,
-        IntVector(0, 0), DblVector(0, 0.0),
-        std::get<Attribute::DBL_VECTOR>(_data)[DblVectorAttribute::LB],
-        std::get<Attribute::DBL_VECTOR>(_data)[DblVectorAttribute::UB],
-        std::get<Attribute::CHAR_VECTOR>(_data)[CharVectorAttribute::COLTYPE],
-        newNames);
+    DblVector weighted_obj;
+    const double *obj = _obj.data();
+    if (objective_weight != 1.0) {
+      weighted_obj.reserve(ncols);
+      for (auto const coefficient : _obj) {
+        weighted_obj.push_back(objective_weight * coefficient);
+      }
+      obj = weighted_obj.data();
+    }
 
-    solver_addrows(
-        *containingSolver_p,
-        std::get<Attribute::CHAR_VECTOR>(_data)[CharVectorAttribute::ROWTYPE],
-        std::get<Attribute::DBL_VECTOR>(_data)[DblVectorAttribute::RHS], {},
-        std::get<Attribute::INT_VECTOR>(_data)[IntVectorAttribute::MSTART],
-        newmindex,
-        std::get<Attribute::DBL_VECTOR>(_data)[DblVectorAttribute::MVALUE]);
+    IntVector mstart(ncols, 0);
+    containingSolver_p->add_cols(ncols, 0, obj, mstart.data(), nullptr,
+                                 nullptr, _lb.data(), _ub.data());
+    IntVector newIndex(ncols);
+    std::iota(newIndex.begin(), newIndex.end(), nbExistingCols);
+    containingSolver_p->chg_col_type(newIndex, _colTypes);
+    for (int i(0); i < static_cast<int>(_colNames.size()); ++i) {
+      containingSolver_p->chg_col_name(nbExistingCols + i,
+                                       prefix_l + _colNames[i]);
+    }
+
+    // simply increment the columns indices, the only copy of the matrix
+    IntVector newmindex(_rows.indexes.begin(), _rows.indexes.end());
+    for (auto &i : newmindex) {
+      i += nbExistingCols;
+    }
+    containingSolver_p->add_rows(
+        static_cast<int>(_rowTypes.size()),
+        static_cast<int>(_rows.values.size()), _rowTypes.data(), _rhs.data(),
+        nullptr, _rows.starts.data(), newmindex.data(), _rows.values.data());
 
     ++appendCNT;
 
     return nbExistingCols;
   }
-
- private:
-  void initialise_int_values_with_zeros() {
-    std::get<Attribute::INT_VALUE>(_data).assign(
-        IntAttribute::MAX_INT_ATTRIBUTE, 0);
-  }
-  void initialise_int_vectors() {
-    std::get<Attribute::INT_VECTOR>(_data).assign(
-        IntVectorAttribute::MAX_INT_VECTOR_ATTRIBUTE, IntVector());
-  }
-  void initialise_char_vectors() {
-    std::get<Attribute::CHAR_VECTOR>(_data).assign(
-        CharVectorAttribute::MAX_CHAR_VECTOR_ATTRIBUTE, CharVector());
-  }
-  void initialise_dbl_vectors() {
-    std::get<Attribute::DBL_VECTOR>(_data).assign(
-        DblVectorAttribute::MAX_DBL_VECTOR_ATTRIBUTE, DblVector());
-  }
 };
 
 class MergeMPS {
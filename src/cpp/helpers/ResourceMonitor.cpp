@@ -0,0 +1,156 @@
+#include "ResourceMonitor.h"
+
+#include <fstream>
+#include <string>
+#include <system_error>
+
+#if defined(__unix__)
+#include <sys/resource.h>
+#include <unistd.h>
+#endif
+
+namespace {
+constexpr double BYTES_PER_MB = 1024. * 1024.;
+
+uint64_t directory_size(const std::filesystem::path& directory) {
+  uint64_t size = 0;
+  std::error_code ec;
+  // files may be written or removed while they are counted
+  for (auto it = std::filesystem::recursive_directory_iterator(
+           directory,
+           std::filesystem::directory_options::skip_permission_denied, ec);
+       !ec && it != std::filesystem::recursive_directory_iterator();
+       it.increment(ec)) {
+    std::error_code file_ec;
+    if (it->is_regular_file(file_ec)) {
+      const auto file_size = it->file_size(file_ec);
+      if (!file_ec) {
+        size += file_size;
+      }
+    }
+  }
+  return size;
+}
+
+#if defined(__unix__)
+void sample_process(ResourceSample& sample) {
+  const auto page_size = static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+  // statm is much cheaper to parse than stat: size resident ... in pages
+  if (std::ifstream statm("/proc/self/statm"); statm) {
+    uint64_t size = 0;
+    uint64_t resident = 0;
+    statm >> size >> resident;
+    sample.virtual_memory_bytes = size * page_size;
+    sample.resident_set_bytes = resident * page_size;
+  }
+  rusage usage{};
+  if (getrusage(RUSAGE_SELF, &usage) == 0) {
+    // kilobytes on Linux
+    sample.peak_resident_set_bytes =
+        static_cast<uint64_t>(usage.ru_maxrss) * 1024;
+    sample.cpu_time =
+        usage.ru_utime.tv_sec + usage.ru_utime.tv_usec * 1e-6 +
+        usage.ru_stime.tv_sec + usage.ru_stime.tv_usec * 1e-6;
+  }
+}
+
+void sample_system_memory(ResourceSample& sample) {
+  std::ifstream meminfo("/proc/meminfo");
+  std::string key;
+  uint64_t value_kb = 0;
+  std::string unit;
+  uint64_t free_buffers_and_cache = 0;
+  bool has_available = false;
+  while (meminfo >> key >> value_kb) {
+    std::getline(meminfo, unit);
+    if (key == "MemTotal:") {
+      sample.total_memory_bytes = value_kb * 1024;
+    } else if (key == "MemAvailable:") {
+      sample.available_memory_bytes = value_kb * 1024;
+      has_available = true;
+    } else if (key == "MemFree:" || key == "Cached:" || key == "Buffers:") {
+      free_buffers_and_cache += value_kb * 1024;
+    }
+  }
+  // kernels older than 3.14
+  if (!has_available) {
+    sample.available_memory_bytes = free_buffers_and_cache;
+  }
+}
+#else
+void sample_process(ResourceSample&) {}
+void sample_system_memory(ResourceSample&) {}
+#endif
+}  // namespace
+
+std::ostream& operator<<(std::ostream& stream, const ResourceSample& sample) {
+  if (!sample.valid) {
+    return stream << "no resource sample";
+  }
+  stream << "RSS: " << sample.resident_set_bytes / BYTES_PER_MB
+         << " MB; peak RSS: " << sample.peak_resident_set_bytes / BYTES_PER_MB
+         << " MB; VM: " << sample.virtual_memory_bytes / BYTES_PER_MB
+         << " MB; memory available: "
+         << sample.available_memory_bytes / BYTES_PER_MB << "/"
+         << sample.total_memory_bytes / BYTES_PER_MB
+         << " MB; CPU time: " << sample.cpu_time << " s";
+  if (sample.watched_directory_bytes > 0 || sample.available_disk_bytes > 0) {
+    stream << "; directory: " << sample.watched_directory_bytes / BYTES_PER_MB
+           << " MB; disk available: "
+           << sample.available_disk_bytes / BYTES_PER_MB << " MB";
+  }
+  return stream;
+}
+
+ResourceMonitor::ResourceMonitor(double period,
+                                 std::filesystem::path watched_directory)
+    : period_(period), watched_directory_(std::move(watched_directory)) {
+  if (!enabled()) {
+    return;
+  }
+  latest_ = Sample(watched_directory_);
+  sampler_ = std::jthread([this](const std::stop_token& stop) { run(stop); });
+}
+
+void ResourceMonitor::watch(const std::filesystem::path& directory) {
+  std::lock_guard lock(mutex_);
+  watched_directory_ = directory;
+}
+
+ResourceSample ResourceMonitor::latest() const {
+  std::lock_guard lock(mutex_);
+  return latest_;
+}
+
+ResourceSample ResourceMonitor::Sample(
+    const std::filesystem::path& watched_directory) {
+  ResourceSample sample;
+  sample_process(sample);
+  sample_system_memory(sample);
+  if (!watched_directory.empty()) {
+    sample.watched_directory_bytes = directory_size(watched_directory);
+    std::error_code ec;
+    const auto space = std::filesystem::space(watched_directory, ec);
+    if (!ec) {
+      sample.available_disk_bytes = space.available;
+    }
+  }
+  sample.valid = true;
+  return sample;
+}
+
+void ResourceMonitor::run(const std::stop_token& stop) {
+  std::unique_lock lock(mutex_);
+  while (true) {
+    // only woken up early by a stop request
+    wake_up_.wait_for(lock, stop, period_, [] { return false; });
+    if (stop.stop_requested()) {
+      return;
+    }
+    const auto directory = watched_directory_;
+    lock.unlock();
+    auto sample = Sample(directory);
+    lock.lock();
+    latest_ = sample;
+  }
+}
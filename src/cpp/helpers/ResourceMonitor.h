@@ -0,0 +1,70 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+#include <ostream>
+#include <stop_token>
+#include <thread>
+
+/*!
+ *  \brief resources used by the process, all zeros when not valid
+ */
+struct ResourceSample {
+  bool valid = false;
+  uint64_t resident_set_bytes = 0;
+  uint64_t peak_resident_set_bytes = 0;
+  uint64_t virtual_memory_bytes = 0;
+  uint64_t available_memory_bytes = 0;
+  uint64_t total_memory_bytes = 0;
+  // size of the files below the watched directory
+  uint64_t watched_directory_bytes = 0;
+  // free space of the file system of the watched directory
+  uint64_t available_disk_bytes = 0;
+  // user and system time of every thread, in seconds
+  double cpu_time = 0;
+};
+
+std::ostream& operator<<(std::ostream& stream, const ResourceSample& sample);
+
+/*!
+ *  \brief samples the resources used by the process in a background thread,
+ * so that logs and loops only read the latest sample instead of probing the
+ * system (and walking directories) themselves
+ */
+class ResourceMonitor {
+ public:
+  /*!
+   *  \brief period in seconds, nothing is sampled when it is not positive
+   */
+  explicit ResourceMonitor(double period,
+                           std::filesystem::path watched_directory = {});
+  ResourceMonitor(const ResourceMonitor&) = delete;
+  ResourceMonitor& operator=(const ResourceMonitor&) = delete;
+
+  /*!
+   *  \brief directory whose size is sampled from the next sample on
+   */
+  void watch(const std::filesystem::path& directory);
+
+  [[nodiscard]] ResourceSample latest() const;
+  [[nodiscard]] bool enabled() const { return period_.count() > 0; }
+
+  /*!
+   *  \brief probes the system now, from the calling thread
+   */
+  static ResourceSample Sample(const std::filesystem::path& watched_directory);
+
+ private:
+  void run(const std::stop_token& stop);
+
+  const std::chrono::duration<double> period_;
+  mutable std::mutex mutex_;
+  std::condition_variable_any wake_up_;
+  std::filesystem::path watched_directory_;
+  ResourceSample latest_;
+  // last member: stopped and joined before the others are destroyed
+  std::jthread sampler_;
+};
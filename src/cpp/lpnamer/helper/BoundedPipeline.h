@@ -0,0 +1,187 @@
+#ifndef ANTARESXPANSION_BOUNDEDPIPELINE_H
+#define ANTARESXPANSION_BOUNDEDPIPELINE_H
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+struct PipelineOptions {
+  // items waiting between two stages
+  size_t queue_depth = 4;
+  // threads of each stage, 0 to use every core
+  size_t workers = 0;
+
+  [[nodiscard]] size_t number_of_workers() const {
+    if (workers > 0) {
+      return workers;
+    }
+    return std::max<size_t>(1, std::thread::hardware_concurrency());
+  }
+  /*!
+   *  \brief largest number of items alive at the same time, whatever the
+   * number of items processed
+   */
+  [[nodiscard]] size_t max_items_in_flight() const {
+    return 3 * number_of_workers() + 2 * std::max<size_t>(1, queue_depth);
+  }
+};
+
+/*!
+ *  \brief blocking queue of at most capacity items
+ */
+template <class T>
+class BoundedQueue {
+ public:
+  explicit BoundedQueue(size_t capacity)
+      : capacity_(std::max<size_t>(1, capacity)) {}
+
+  /*!
+   *  \brief waits for a free slot, false if the queue was closed meanwhile
+   */
+  bool push(T item) {
+    std::unique_lock lock(mutex_);
+    not_full_.wait(lock,
+                   [this] { return closed_ || items_.size() < capacity_; });
+    if (closed_) {
+      return false;
+    }
+    items_.push_back(std::move(item));
+    not_empty_.notify_one();
+    return true;
+  }
+
+  /*!
+   *  \brief waits for an item, nullopt once the queue is closed and empty
+   */
+  std::optional<T> pop() {
+    std::unique_lock lock(mutex_);
+    not_empty_.wait(lock, [this] { return closed_ || !items_.empty(); });
+    if (items_.empty()) {
+      return std::nullopt;
+    }
+    std::optional<T> result(std::move(items_.front()));
+    items_.pop_front();
+    not_full_.notify_one();
+    return result;
+  }
+
+  /*!
+   *  \brief no more push, the items already queued can still be popped
+   */
+  void close() {
+    std::lock_guard lock(mutex_);
+    closed_ = true;
+    not_empty_.notify_all();
+    not_full_.notify_all();
+  }
+
+  /*!
+   *  \brief close and drop the queued items
+   */
+  void cancel() {
+    std::lock_guard lock(mutex_);
+    closed_ = true;
+    items_.clear();
+    not_empty_.notify_all();
+    not_full_.notify_all();
+  }
+
+ private:
+  const size_t capacity_;
+  std::mutex mutex_;
+  std::condition_variable not_full_;
+  std::condition_variable not_empty_;
+  std::deque<T> items_;
+  bool closed_ = false;
+};
+
+/*!
+ *  \brief runs read(index) -> modify(item) -> write(item) for every index in
+ * [0, count), each stage on its own threads with bounded queues between them,
+ * so that the number of items alive does not depend on count. The first
+ * exception thrown by a stage stops the pipeline and is rethrown.
+ */
+template <class T>
+void RunBoundedPipeline(size_t count, const PipelineOptions& options,
+                        const std::function<T(size_t)>& read,
+                        const std::function<void(T&)>& modify,
+                        const std::function<void(T&)>& write) {
+  const auto workers = options.number_of_workers();
+  BoundedQueue<T> read_items(options.queue_depth);
+  BoundedQueue<T> modified_items(options.queue_depth);
+  std::atomic<size_t> next_index{0};
+  std::atomic<size_t> active_readers{workers};
+  std::atomic<size_t> active_modifiers{workers};
+  std::mutex error_mutex;
+  std::exception_ptr error;
+
+  const auto fail = [&](std::exception_ptr exception) {
+    {
+      std::lock_guard lock(error_mutex);
+      if (!error) {
+        error = std::move(exception);
+      }
+    }
+    read_items.cancel();
+    modified_items.cancel();
+  };
+
+  std::vector<std::thread> threads;
+  threads.reserve(3 * workers);
+  for (size_t worker(0); worker < workers; ++worker) {
+    threads.emplace_back([&] {
+      try {
+        for (auto index = next_index++; index < count; index = next_index++) {
+          if (!read_items.push(read(index))) {
+            break;
+          }
+        }
+      } catch (...) {
+        fail(std::current_exception());
+      }
+      if (--active_readers == 0) {
+        read_items.close();
+      }
+    });
+    threads.emplace_back([&] {
+      try {
+        while (auto item = read_items.pop()) {
+          modify(*item);
+          if (!modified_items.push(std::move(*item))) {
+            break;
+          }
+        }
+      } catch (...) {
+        fail(std::current_exception());
+      }
+      if (--active_modifiers == 0) {
+        modified_items.close();
+      }
+    });
+    threads.emplace_back([&] {
+      try {
+        while (auto item = modified_items.pop()) {
+          write(*item);
+        }
+      } catch (...) {
+        fail(std::current_exception());
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  if (error) {
+    std::rethrow_exception(error);
+  }
+}
+
+#endif  // ANTARESXPANSION_BOUNDEDPIPELINE_H
@@ -1,9 +1,65 @@
 #include "LinkProfileReader.h"
 
+#include <charconv>
+#include <chrono>
+#include <cstring>
 #include <filesystem>
+#include <fstream>
+#include <sstream>
 
 #include "LogUtils.h"
 
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+/* bump when the binary layout changes so that old cache files are ignored */
+constexpr char CACHE_MAGIC[8] = {'X', 'P', 'L', 'P', 'R', 'O', 'F', '1'};
+/* entries left unused by the runs for this long are removed */
+constexpr auto UNUSED_CACHE_ENTRY_LIFETIME = std::chrono::hours(24 * 30);
+
+struct CacheHeader {
+  char magic[8];
+  uint64_t key;
+  uint32_t chronicles;
+  uint32_t hours;
+};
+
+constexpr uint64_t FNV_OFFSET_BASIS = 14695981039346656037ULL;
+constexpr uint64_t FNV_PRIME = 1099511628211ULL;
+
+uint64_t HashContent(std::string_view content, uint64_t hash) {
+  for (const auto c : content) {
+    hash ^= static_cast<unsigned char>(c);
+    hash *= FNV_PRIME;
+  }
+  return hash;
+}
+
+bool IsBlank(char c) {
+  return c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+}
+
+bool ParseNumber(std::string_view token, double &result) {
+  // from_chars does not accept an explicit plus sign
+  if (!token.empty() && token.front() == '+') {
+    token.remove_prefix(1);
+  }
+  const auto [end, ec] =
+      std::from_chars(token.data(), token.data() + token.size(), result);
+  return ec == std::errc() && end == token.data() + token.size();
+}
+
+size_t CacheFileSize(uint32_t chronicles) {
+  return sizeof(CacheHeader) +
+         2 * sizeof(double) * NUMBER_OF_HOUR_PER_YEAR * chronicles;
+}
+}  // namespace
+
 std::vector<LinkProfile> LinkProfileReader::ReadLinkProfile(
     const std::filesystem::path &direct_filename,
     const std::filesystem::path &indirect_file_name) {
@@ -12,9 +68,23 @@ std::vector<LinkProfile> LinkProfileReader::ReadLinkProfile(
       << "indirect_file_name: " << indirect_file_name << "\n";
   EnsureFileIsGood(direct_filename);
   EnsureFileIsGood(indirect_file_name);
+  const auto direct_content = ReadFile(direct_filename);
+  const auto indirect_content = ReadFile(indirect_file_name);
+
+  const auto key =
+      HashContent(indirect_content,
+                  HashContent(direct_content, FNV_OFFSET_BASIS) * FNV_PRIME);
+  if (!cache_directory_.empty()) {
+    used_cache_entries_.insert(CachePath(key));
+  }
+  if (auto cached = LoadFromCache(key)) {
+    return std::move(*cached);
+  }
+
   std::vector<LinkProfile> result;
-  ReadLinkProfile(direct_filename, result, true);
-  ReadLinkProfile(indirect_file_name, result, false);
+  ParseLinkProfile(direct_content, direct_filename, result, true);
+  ParseLinkProfile(indirect_content, indirect_file_name, result, false);
+  SaveToCache(key, result);
   return result;
 }
 void LinkProfileReader::EnsureFileIsGood(
@@ -29,22 +99,28 @@ void LinkProfileReader::EnsureFileIsGood(
 
 std::vector<LinkProfile> LinkProfileReader::ReadLinkProfile(
     const std::filesystem::path &direct_filename) {
+  const auto content = ReadFile(direct_filename);
+  const auto key = HashContent(content, FNV_OFFSET_BASIS);
+  if (!cache_directory_.empty()) {
+    used_cache_entries_.insert(CachePath(key));
+  }
+  if (auto cached = LoadFromCache(key)) {
+    return std::move(*cached);
+  }
+
   std::vector<LinkProfile> result;
-  ReadLinkProfile(direct_filename, result, true);
-  ReadLinkProfile(direct_filename, result, false);
+  ParseLinkProfile(content, direct_filename, result, true);
+  // the same file gives both directions
+  for (auto &profile : result) {
+    profile.indirect_link_profile = profile.direct_link_profile;
+  }
+  SaveToCache(key, result);
   return result;
 }
-bool is_number(std::string const &str, double &result) {
-  auto i = std::istringstream(str);
-
-  i >> result;
 
-  return !i.fail() && i.eof();
-}
-void LinkProfileReader::ReadLinkProfile(const std::filesystem::path &filename,
-                                        std::vector<LinkProfile> &result,
-                                        bool fillDirectProfile) {
-  std::ifstream infile(filename);
+std::string LinkProfileReader::ReadFile(
+    const std::filesystem::path &filename) const {
+  std::ifstream infile(filename, std::ios::binary | std::ios::ate);
   if (!infile.good()) {
     auto errMsg = std::string("unable to open file ");
     (*logger_)(LogUtils::LOGLEVEL::FATAL)
@@ -52,47 +128,61 @@ void LinkProfileReader::ReadLinkProfile(const std::filesystem::path &filename,
     throw std::filesystem::filesystem_error(LOGLOCATION + errMsg, filename,
                                             std::error_code());
   }
-  std::string str_value;
-  double value;
-  std::string line;
-  int chronicle_id = 0;
+  std::string content(static_cast<size_t>(infile.tellg()), '\0');
+  infile.seekg(0);
+  infile.read(content.data(), static_cast<std::streamsize>(content.size()));
+  return content;
+}
+
+void LinkProfileReader::ParseLinkProfile(std::string_view content,
+                                         const std::filesystem::path &filename,
+                                         std::vector<LinkProfile> &result,
+                                         bool fillDirectProfile) const {
+  size_t line_begin = 0;
   for (size_t time_step(0); time_step < NUMBER_OF_HOUR_PER_YEAR; ++time_step) {
-    if (std::getline(infile, line)) {
-      std::stringstream buffer(line);
-      chronicle_id = 0;
-      while (buffer >> str_value) {
-        if (is_number(str_value, value)) {
-          ConstructChronicle(result, chronicle_id);
-          UpdateProfile(result, fillDirectProfile, value, chronicle_id,
-                        time_step);
-          ++chronicle_id;
-        } else {
-          auto errMsg =
-              std::string("Error while reading value in link-profile ") +
-              filename.string() + " line " + std::to_string(time_step) + "\n";
-          (*logger_)(LogUtils::LOGLEVEL::FATAL) << LOGLOCATION << errMsg;
-          throw std::domain_error(errMsg);
-        }
-      }
-    } else {
+    if (line_begin >= content.size()) {
       auto errMsg = std::string("error not enough line in link-profile ") +
                     filename.string();
-      (*logger_)(LogUtils::LOGLEVEL::FATAL)
-          << LOGLOCATION << errMsg;
+      (*logger_)(LogUtils::LOGLEVEL::FATAL) << LOGLOCATION << errMsg;
       throw std::domain_error(errMsg);
     }
-  }
-  infile.close();
-}
-void LinkProfileReader::UpdateProfile(std::vector<LinkProfile> &result,
-                                      bool directProfile, double value,
-                                      int chronicle_id,
-                                      size_t time_step) const {
-  LinkProfile &profile = result.at(chronicle_id);
-  if (directProfile) {
-    profile.direct_link_profile.at(time_step) = value;
-  } else {
-    profile.indirect_link_profile.at(time_step) = value;
+    auto line_end = content.find('\n', line_begin);
+    if (line_end == std::string_view::npos) {
+      line_end = content.size();
+    }
+
+    int chronicle_id = 0;
+    size_t position = line_begin;
+    while (position < line_end) {
+      while (position < line_end && IsBlank(content[position])) {
+        ++position;
+      }
+      const auto token_begin = position;
+      while (position < line_end && !IsBlank(content[position])) {
+        ++position;
+      }
+      if (token_begin == position) {
+        break;
+      }
+      double value;
+      if (!ParseNumber(content.substr(token_begin, position - token_begin),
+                       value)) {
+        auto errMsg =
+            std::string("Error while reading value in link-profile ") +
+            filename.string() + " line " + std::to_string(time_step) + "\n";
+        (*logger_)(LogUtils::LOGLEVEL::FATAL) << LOGLOCATION << errMsg;
+        throw std::domain_error(errMsg);
+      }
+      ConstructChronicle(result, chronicle_id);
+      LinkProfile &profile = result[chronicle_id];
+      if (fillDirectProfile) {
+        profile.direct_link_profile[time_step] = value;
+      } else {
+        profile.indirect_link_profile[time_step] = value;
+      }
+      ++chronicle_id;
+    }
+    line_begin = line_end + 1;
   }
 }
 
@@ -103,11 +193,114 @@ void LinkProfileReader::ConstructChronicle(std::vector<LinkProfile> &result,
   }
 }
 
-std::map<std::string, std::vector<LinkProfile>>
-LinkProfileReader::getLinkProfileMap(
+std::filesystem::path LinkProfileReader::CachePath(uint64_t key) const {
+  std::ostringstream name;
+  name << std::hex << key << ".bin";
+  return cache_directory_ / name.str();
+}
+
+std::optional<std::vector<LinkProfile>> LinkProfileReader::LoadFromCache(
+    uint64_t key) const {
+  if (cache_directory_.empty()) {
+    return std::nullopt;
+  }
+  const auto cache_path = CachePath(key);
+  std::error_code error;
+  const auto file_size = std::filesystem::file_size(cache_path, error);
+  if (error || file_size < sizeof(CacheHeader)) {
+    return std::nullopt;
+  }
+
+#if defined(__unix__) || defined(__APPLE__)
+  const int fd = ::open(cache_path.string().c_str(), O_RDONLY);
+  if (fd < 0) {
+    return std::nullopt;
+  }
+  void *mapping = ::mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  ::close(fd);
+  if (mapping == MAP_FAILED) {
+    return std::nullopt;
+  }
+  const auto *data = static_cast<const char *>(mapping);
+#else
+  std::string buffer(file_size, '\0');
+  std::ifstream cache_file(cache_path, std::ios::binary);
+  cache_file.read(buffer.data(), static_cast<std::streamsize>(file_size));
+  const auto *data = buffer.data();
+#endif
+
+  std::optional<std::vector<LinkProfile>> result;
+  CacheHeader header;
+  std::memcpy(&header, data, sizeof(CacheHeader));
+  if (std::memcmp(header.magic, CACHE_MAGIC, sizeof(CACHE_MAGIC)) == 0 &&
+      header.key == key && header.hours == NUMBER_OF_HOUR_PER_YEAR &&
+      file_size == CacheFileSize(header.chronicles)) {
+    result.emplace();
+    result->reserve(header.chronicles);
+    const auto *values =
+        reinterpret_cast<const double *>(data + sizeof(CacheHeader));
+    for (uint32_t chronicle(0); chronicle < header.chronicles; ++chronicle) {
+      auto &profile = result->emplace_back(logger_);
+      profile.direct_link_profile.assign(values,
+                                         values + NUMBER_OF_HOUR_PER_YEAR);
+      values += NUMBER_OF_HOUR_PER_YEAR;
+      profile.indirect_link_profile.assign(values,
+                                           values + NUMBER_OF_HOUR_PER_YEAR);
+      values += NUMBER_OF_HOUR_PER_YEAR;
+    }
+  }
+
+#if defined(__unix__) || defined(__APPLE__)
+  ::munmap(mapping, file_size);
+#endif
+  return result;
+}
+
+void LinkProfileReader::SaveToCache(
+    uint64_t key, const std::vector<LinkProfile> &result) const {
+  if (cache_directory_.empty()) {
+    return;
+  }
+  std::error_code error;
+  std::filesystem::create_directories(cache_directory_, error);
+  // the cache is an optimization only, a read only study is not an error
+  const auto cache_path = CachePath(key);
+  auto temporary_path = cache_path;
+  temporary_path += ".tmp";
+  {
+    std::ofstream cache_file(temporary_path, std::ios::binary);
+    if (!cache_file) {
+      (*logger_)(LogUtils::LOGLEVEL::DEBUG)
+          << LOGLOCATION << "unable to write profile cache " << cache_path
+          << "\n";
+      return;
+    }
+    CacheHeader header{};
+    std::memcpy(header.magic, CACHE_MAGIC, sizeof(CACHE_MAGIC));
+    header.key = key;
+    header.chronicles = static_cast<uint32_t>(result.size());
+    header.hours = NUMBER_OF_HOUR_PER_YEAR;
+    cache_file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    for (const auto &profile : result) {
+      cache_file.write(
+          reinterpret_cast<const char *>(profile.direct_link_profile.data()),
+          sizeof(double) * NUMBER_OF_HOUR_PER_YEAR);
+      cache_file.write(
+          reinterpret_cast<const char *>(profile.indirect_link_profile.data()),
+          sizeof(double) * NUMBER_OF_HOUR_PER_YEAR);
+    }
+  }
+  // concurrent readers never see a partially written file
+  std::filesystem::rename(temporary_path, cache_path, error);
+  if (error) {
+    std::filesystem::remove(temporary_path, error);
+  }
+}
+
+std::map<std::string, SharedLinkProfiles> LinkProfileReader::getLinkProfileMap(
     const std::filesystem::path &capacity_folder,
     const std::vector<CandidateData> &candidateList) {
-  std::map<std::string, std::vector<LinkProfile>> mapLinkProfile;
+  std::map<std::string, SharedLinkProfiles> mapLinkProfile;
   for (const auto &candidate_data : candidateList) {
     importProfile(mapLinkProfile, capacity_folder,
                   candidate_data.installed_direct_link_profile_name,
@@ -116,18 +309,75 @@ LinkProfileReader::getLinkProfileMap(
                   candidate_data.direct_link_profile,
                   candidate_data.indirect_link_profile);
   }
+  RemoveUnusedCacheEntries();
   return mapLinkProfile;
 }
 
+bool LinkProfileReader::IsCacheEntry(const std::filesystem::path &path) const {
+  // named after its key by CachePath, the key being repeated in its header
+  uint64_t key = 0;
+  const auto name = path.stem().string();
+  const auto [end, ec] =
+      std::from_chars(name.data(), name.data() + name.size(), key, 16);
+  if (ec != std::errc() || end != name.data() + name.size() ||
+      path.extension() != ".bin" || CachePath(key) != path) {
+    return false;
+  }
+  CacheHeader header{};
+  std::ifstream cache_file(path, std::ios::binary);
+  cache_file.read(reinterpret_cast<char *>(&header), sizeof(header));
+  return cache_file &&
+         std::memcmp(header.magic, CACHE_MAGIC, sizeof(CACHE_MAGIC)) == 0 &&
+         header.key == key;
+}
+
+void LinkProfileReader::RemoveUnusedCacheEntries() const {
+  if (cache_directory_.empty()) {
+    return;
+  }
+  std::error_code error;
+  const auto now = std::filesystem::file_time_type::clock::now();
+  // the entries used by this run are kept for the lifetime from now on
+  for (const auto &path : used_cache_entries_) {
+    std::filesystem::last_write_time(path, now, error);
+  }
+  // the directory may be shared by other studies, and the temporary files
+  // of concurrent writers are left alone
+  std::vector<std::filesystem::path> stale_entries;
+  for (const auto &entry :
+       std::filesystem::directory_iterator(cache_directory_, error)) {
+    const auto &path = entry.path();
+    if (used_cache_entries_.find(path) == used_cache_entries_.end() &&
+        entry.last_write_time(error) + UNUSED_CACHE_ENTRY_LIFETIME < now &&
+        !error && IsCacheEntry(path)) {
+      stale_entries.push_back(path);
+    }
+  }
+  for (const auto &path : stale_entries) {
+    std::filesystem::remove(path, error);
+    (*logger_)(LogUtils::LOGLEVEL::DEBUG)
+        << LOGLOCATION << "removed unused profile cache " << path << "\n";
+  }
+}
+
 void LinkProfileReader::importProfile(
-    std::map<std::string, std::vector<LinkProfile>> &mapLinkProfile,
+    std::map<std::string, SharedLinkProfiles> &mapLinkProfile,
     const std::filesystem::path &capacitySubfolder,
     const std::string &direct_profile_name,
     const std::string &indirect_profile_name) {
-  if (!direct_profile_name.empty() &&
-      mapLinkProfile.find(direct_profile_name) == mapLinkProfile.end()) {
-    mapLinkProfile[direct_profile_name] = LinkProfileReader::ReadLinkProfile(
-        capacitySubfolder / direct_profile_name,
-        capacitySubfolder / indirect_profile_name);
+  if (direct_profile_name.empty() ||
+      mapLinkProfile.find(direct_profile_name) != mapLinkProfile.end()) {
+    return;
   }
-}
\ No newline at end of file
+  const auto direct_file = capacitySubfolder / direct_profile_name;
+  const auto indirect_file = capacitySubfolder / indirect_profile_name;
+  const auto key =
+      LinkProfileStore::Key(direct_file.string(), indirect_file.string());
+  auto profiles = store_.Find(key);
+  if (!profiles) {
+    profiles =
+        store_.Insert(key, LinkProfileReader::ReadLinkProfile(direct_file,
+                                                              indirect_file));
+  }
+  mapLinkProfile[direct_profile_name] = std::move(profiles);
+}
@@ -1,12 +1,18 @@
 #ifndef ANTARESXPANSION_LINKPROFILEREADER_H
 #define ANTARESXPANSION_LINKPROFILEREADER_H
 
+#include <cstdint>
 #include <filesystem>
 #include <map>
+#include <optional>
+#include <set>
+#include <string>
+#include <string_view>
 #include <utility>
 
 #include "Candidate.h"
 #include "LinkProfile.h"
+#include "LinkProfileStore.h"
 #include "ProblemGenerationLogger.h"
 
 class LinkProfileReader {
@@ -15,31 +21,59 @@ class LinkProfileReader {
       ProblemGenerationLog::ProblemGenerationLoggerSharedPointer logger)
       : logger_(std::move(logger)) {}
 
+  /*!
+   *  \brief keeps a binary copy of every parsed profile in cache_directory,
+   * keyed by a hash of the profile files content. Later reads of the same
+   * content map the binary copy instead of parsing the text files. Disabled
+   * while the directory is empty, which is the default.
+   */
+  void setCacheDirectory(std::filesystem::path cache_directory) {
+    cache_directory_ = std::move(cache_directory);
+  }
+
   std::vector<LinkProfile> ReadLinkProfile(
       const std::filesystem::path& direct_filename,
       const std::filesystem::path& indirect_file_name);
   std::vector<LinkProfile> ReadLinkProfile(
       const std::filesystem::path& direct_filename);
-  std::map<std::string, std::vector<LinkProfile>> getLinkProfileMap(
+  /*!
+   *  \brief profiles of every candidate, read once per profile files and
+   * shared through the store of the reader. The copies of the cache
+   * directory that no run has used for 30 days are removed afterwards.
+   */
+  std::map<std::string, SharedLinkProfiles> getLinkProfileMap(
       const std::filesystem::path& capacity_folder,
       const std::vector<CandidateData>& candidateList);
 
+  [[nodiscard]] const LinkProfileStore& store() const { return store_; }
+
  private:
   void importProfile(
-      std::map<std::string, std::vector<LinkProfile>>& mapLinkProfile,
+      std::map<std::string, SharedLinkProfiles>& mapLinkProfile,
       const std::filesystem::path& capacitySubfolder,
       const std::string& direct_profile_name,
       const std::string& indirect_profile_name);
 
-  void ReadLinkProfile(const std::filesystem::path& filename,
-                       std::vector<LinkProfile>& result,
-                       bool fillDirectProfile);
+  std::string ReadFile(const std::filesystem::path& filename) const;
+  void ParseLinkProfile(std::string_view content,
+                        const std::filesystem::path& filename,
+                        std::vector<LinkProfile>& result,
+                        bool fillDirectProfile) const;
 
   void ConstructChronicle(std::vector<LinkProfile>& result, int chronicle_id)const;
-  void UpdateProfile(std::vector<LinkProfile>& result, bool directProfile,
-                     double value, int chronicle_id, size_t time_step)const;
   void EnsureFileIsGood(const std::filesystem::path& direct_filename) const;
+
+  [[nodiscard]] std::filesystem::path CachePath(uint64_t key) const;
+  [[nodiscard]] std::optional<std::vector<LinkProfile>> LoadFromCache(
+      uint64_t key) const;
+  void SaveToCache(uint64_t key, const std::vector<LinkProfile>& result) const;
+  [[nodiscard]] bool IsCacheEntry(const std::filesystem::path& path) const;
+  void RemoveUnusedCacheEntries() const;
+
   ProblemGenerationLog::ProblemGenerationLoggerSharedPointer logger_;
+  std::filesystem::path cache_directory_;
+  std::set<std::filesystem::path> used_cache_entries_;
+  LinkProfileStore store_;
 };
 
 #endif  // ANTARESXPANSION_LINKPROFILEREADER_H
@@ -2,7 +2,125 @@
 #include "VariableFileReader.h"
 
 #include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <fstream>
+#include <iterator>
 #include <sstream>
+#include <unordered_set>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+bool IsBlank(char c) {
+  return c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+}
+
+/* whitespace separated fields of a line, as read by operator>> */
+class LineTokenizer {
+ public:
+  explicit LineTokenizer(std::string_view line) : line_(line) {}
+
+  bool next(std::string_view& token) {
+    while (position_ < line_.size() && IsBlank(line_[position_])) {
+      ++position_;
+    }
+    const auto begin = position_;
+    while (position_ < line_.size() && !IsBlank(line_[position_])) {
+      ++position_;
+    }
+    token = line_.substr(begin, position_ - begin);
+    return !token.empty();
+  }
+
+  template <class T>
+  T number() {
+    std::string_view token;
+    T result{};
+    if (next(token)) {
+      std::from_chars(token.data(), token.data() + token.size(), result);
+    }
+    return result;
+  }
+
+ private:
+  std::string_view line_;
+  size_t position_ = 0;
+};
+
+/* content of a file, mapped in memory when the platform allows it */
+class FileContent {
+ public:
+  explicit FileContent(const std::filesystem::path& file_name) {
+#if defined(__unix__) || defined(__APPLE__)
+    fd_ = ::open(file_name.string().c_str(), O_RDONLY);
+    if (fd_ < 0) {
+      return;
+    }
+    good_ = true;
+    struct stat file_stat {};
+    if (::fstat(fd_, &file_stat) != 0 || file_stat.st_size == 0) {
+      return;
+    }
+    size_ = static_cast<size_t>(file_stat.st_size);
+    mapping_ = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd_, 0);
+    if (mapping_ == MAP_FAILED) {
+      mapping_ = nullptr;
+      size_ = 0;
+      good_ = ReadWholeFile(file_name);
+      return;
+    }
+#ifdef MADV_SEQUENTIAL
+    ::madvise(mapping_, size_, MADV_SEQUENTIAL);
+#endif
+#else
+    good_ = ReadWholeFile(file_name);
+#endif
+  }
+  ~FileContent() {
+#if defined(__unix__) || defined(__APPLE__)
+    if (mapping_) {
+      ::munmap(mapping_, size_);
+    }
+    if (fd_ >= 0) {
+      ::close(fd_);
+    }
+#endif
+  }
+  FileContent(const FileContent&) = delete;
+  FileContent& operator=(const FileContent&) = delete;
+
+  [[nodiscard]] bool good() const { return good_; }
+  [[nodiscard]] std::string_view view() const {
+    if (mapping_) {
+      return {static_cast<const char*>(mapping_), size_};
+    }
+    return buffer_;
+  }
+
+ private:
+  bool ReadWholeFile(const std::filesystem::path& file_name) {
+    std::ifstream file(file_name, std::ios::binary);
+    if (!file.good()) {
+      return false;
+    }
+    buffer_.assign(std::istreambuf_iterator<char>(file),
+                   std::istreambuf_iterator<char>());
+    return true;
+  }
+
+  bool good_ = false;
+  int fd_ = -1;
+  void* mapping_ = nullptr;
+  size_t size_ = 0;
+  std::string buffer_;
+};
+}  // namespace
 
 void updateMapColumn(const std::vector<ActiveLink>& links, int link_id,
                      colId id, unsigned int time_step,
@@ -22,16 +140,14 @@ VariableFileReader::VariableFileReader(
     const VariableFileReadNameConfiguration& variable_name_config,
     ProblemGenerationLog::ProblemGenerationLoggerSharedPointer logger)
     : logger_(logger) {
-  std::string line;
-  std::ifstream file(fileName.c_str());
+  const FileContent file(fileName);
   if (!file.good()) {
     auto log_location = LOGLOCATION;
     auto errMsg = "Unable to open '" + fileName.string() + "'";
     (*logger_)(LogUtils::LOGLEVEL::FATAL) << log_location << errMsg;
     throw VariablesNotFound(errMsg, log_location);
   }
-  ReadVarsFromStream(file, links, variable_name_config);
-  file.close();
+  ReadVarsFromBuffer(file.view(), links, variable_name_config);
 }
 
 VariableFileReader::VariableFileReader(
@@ -42,61 +158,90 @@ VariableFileReader::VariableFileReader(
     : logger_(logger) {
   ReadVarsFromStream(fileInIStringStream, links, variable_name_config);
 }
+
 void VariableFileReader::ReadVarsFromStream(
     std::istream& stream, const std::vector<ActiveLink>& links,
     const VariableFileReadNameConfiguration& variable_name_config) {
-  std::string line;
-  while (std::getline(stream, line)) {
-    std::string name = getVarNameFromLine(line);
+  const std::string content((std::istreambuf_iterator<char>(stream)),
+                            std::istreambuf_iterator<char>());
+  ReadVarsFromBuffer(content, links, variable_name_config);
+}
+
+void VariableFileReader::ReadVarsFromBuffer(
+    std::string_view content, const std::vector<ActiveLink>& links,
+    const VariableFileReadNameConfiguration& variable_name_config) {
+  std::unordered_set<int> active_link_ids;
+  active_link_ids.reserve(links.size());
+  for (const auto& link : links) {
+    active_link_ids.insert(static_cast<int>(link.get_idLink()));
+  }
+  std::unordered_map<linkId, ColumnsToChange> ntc_columns;
+  std::unordered_map<linkId, ColumnsToChange> direct_cost_columns;
+  std::unordered_map<linkId, ColumnsToChange> indirect_cost_columns;
+  const auto add_column = [&active_link_ids](
+                              std::unordered_map<linkId, ColumnsToChange>&
+                                  columns,
+                              int link_id, colId id, unsigned int time_step) {
+    if (active_link_ids.find(link_id) != active_link_ids.end()) {
+      columns[link_id].emplace_back(id, time_step);
+    }
+  };
+
+  _variables.reserve(_variables.size() +
+                     std::count(content.begin(), content.end(), '\n') + 1);
+  std::string name;
+  size_t line_begin = 0;
+  while (line_begin < content.size()) {
+    auto line_end = content.find('\n', line_begin);
+    if (line_end == std::string_view::npos) {
+      line_end = content.size();
+    }
+    const auto line = content.substr(line_begin, line_end - line_begin);
+    line_begin = line_end + 1;
+
+    // every field but the column id, each followed by '_'
+    name.clear();
+    LineTokenizer name_fields(line);
+    std::string_view token;
+    name_fields.next(token);
+    while (name_fields.next(token)) {
+      name.append(token).push_back('_');
+    }
     _variables.push_back(name);
 
-    std::istringstream buffer(line);
-    colId id;
-    std::string variable;
-    buffer >> id;
-    buffer >> variable;
+    LineTokenizer fields(line);
+    const auto id = fields.number<colId>();
+    std::string_view variable;
+    fields.next(variable);
 
     if (variable == variable_name_config.ntc_variable_name) {
-      int pays;
-      int link_id;
-      unsigned int time_step;
-      buffer >> pays;
-      buffer >> link_id;
-      buffer >> time_step;
-      updateMapColumn(links, link_id, id, time_step, _ntc_p_var_columns);
+      fields.number<int>();  // pays
+      const auto link_id = fields.number<int>();
+      const auto time_step = fields.number<unsigned int>();
+      add_column(ntc_columns, link_id, id, time_step);
     } else if (variable == variable_name_config.cost_extremite_variable_name) {
-      int link_id;
-      int time_step;
-      buffer >> link_id;
-      buffer >> time_step;
-      updateMapColumn(links, link_id, id, time_step,
-                      _indirect_cost_p_var_columns);
+      const auto link_id = fields.number<int>();
+      const auto time_step = fields.number<int>();
+      add_column(indirect_cost_columns, link_id, id, time_step);
     } else if (variable == variable_name_config.cost_origin_variable_name) {
-      int link_id;
-      int time_step;
-      buffer >> link_id;
-      buffer >> time_step;
-      updateMapColumn(links, link_id, id, time_step,
-                      _direct_cost_p_var_columns);
+      const auto link_id = fields.number<int>();
+      const auto time_step = fields.number<int>();
+      add_column(direct_cost_columns, link_id, id, time_step);
     }
   }
-}
-std::string VariableFileReader::getVarNameFromLine(
-    const std::string& line) const {
-  std::ostringstream name;
-  {
-    std::istringstream buffer(line);
-    std::string part;
-    bool is_first(true);
-    while (buffer >> part) {
-      if (!is_first) {
-        name << part << "_";
-      } else {
-        is_first = false;
-      }
+
+  const auto merge = [](std::unordered_map<linkId, ColumnsToChange>& from,
+                        std::map<linkId, ColumnsToChange>& to) {
+    for (auto& [link_id, columns] : from) {
+      auto& destination = to[link_id];
+      destination.insert(destination.end(),
+                         std::make_move_iterator(columns.begin()),
+                         std::make_move_iterator(columns.end()));
     }
-  }
-  return name.str();
+  };
+  merge(ntc_columns, _ntc_p_var_columns);
+  merge(direct_cost_columns, _direct_cost_p_var_columns);
+  merge(indirect_cost_columns, _indirect_cost_p_var_columns);
 }
 
 const std::vector<std::string>& VariableFileReader::getVariables() const {
@@ -9,6 +9,7 @@
 #include <istream>
 #include <sstream>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include "LogUtils.h"
@@ -38,6 +39,12 @@ class VariableFileReader {
   void ReadVarsFromStream(
       std::istream& stream, const std::vector<ActiveLink>& links,
       const VariableFileReadNameConfiguration& variable_name_config);
+  /*!
+   *  \brief single pass over the whole content, fields are parsed in place
+   */
+  void ReadVarsFromBuffer(
+      std::string_view content, const std::vector<ActiveLink>& links,
+      const VariableFileReadNameConfiguration& variable_name_config);
   const std::vector<std::string>& getVariables() const;
   const std::map<linkId, ColumnsToChange>& getNtcVarColumns() const;
   const std::map<linkId, ColumnsToChange>& getDirectCostVarColumns() const;
@@ -48,8 +55,6 @@ class VariableFileReader {
   };
 
  private:
-  std::string getVarNameFromLine(const std::string& line) const;
-
   std::vector<std::string> _variables;
   std::map<linkId, ColumnsToChange> _ntc_p_var_columns;
   std::map<linkId, ColumnsToChange> _indirect_cost_p_var_columns;
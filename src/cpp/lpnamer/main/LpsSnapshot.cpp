@@ -0,0 +1,206 @@
+#include "include/LpsSnapshot.h"
+
+#include <algorithm>
+#include <boost/archive/binary_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
+#include <boost/serialization/map.hpp>
+#include <boost/serialization/serialization.hpp>
+#include <boost/serialization/string.hpp>
+#include <boost/serialization/vector.hpp>
+#include <chrono>
+#include <ctime>
+#include <exception>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace boost::serialization {
+template <class Archive>
+void serialize(Archive& ar, Antares::Solver::ConstantDataFromAntares& data, const unsigned int version) {
+        ar& data.VariablesCount;
+        ar& data.ConstraintesCount;
+        ar& data.CoeffCount;
+        ar& data.VariablesType;
+        ar& data.Mdeb;
+        ar& data.NotNullTermCount;
+        ar& data.ColumnIndexes;
+        ar& data.ConstraintsMatrixCoeff;
+        ar& data.VariablesMeaning;
+        ar& data.ConstraintsMeaning;
+}
+
+template <class Archive>
+void serialize(Archive& ar, Antares::Solver::WeeklyProblemId& data, const unsigned int version) {
+  ar& data.year;
+  ar& data.week;
+}
+
+
+template <class Archive>
+void serialize(Archive& ar, Antares::Solver::WeeklyDataFromAntares& data, const unsigned int version) {
+  ar& data.Direction;
+  ar& data.Xmax;
+  ar& data.Xmin;
+  ar& data.LinearCost;
+  ar& data.RHS;
+  ar& data.name;
+  ar& data.variables;
+  ar& data.constraints;
+}
+
+template <class Archive>
+void serialize(Archive& ar, Antares::Solver::LpsFromAntares& data, const unsigned int version) {
+        ar& data.constantProblemData;
+        ar& data.weeklyProblems;
+}
+}  // namespace boost::serialization
+
+namespace {
+// to be increased whenever the content of a snapshot changes
+constexpr unsigned int SNAPSHOT_FORMAT_VERSION = 2;
+const std::string SNAPSHOT_MAGIC = "antares-xpansion lps snapshot";
+
+constexpr uint64_t FNV_OFFSET_BASIS = 14695981039346656037ULL;
+constexpr uint64_t FNV_PRIME = 1099511628211ULL;
+
+void hash_bytes(uint64_t& hash, const char* data, size_t size) {
+  for (size_t i(0); i < size; ++i) {
+    hash ^= static_cast<unsigned char>(data[i]);
+    hash *= FNV_PRIME;
+  }
+}
+
+void hash_file(uint64_t& hash, const std::filesystem::path& file) {
+  std::ifstream stream(file, std::ios::binary);
+  std::vector<char> buffer(1 << 20);
+  while (stream.read(buffer.data(), buffer.size()) || stream.gcount() > 0) {
+    hash_bytes(hash, buffer.data(), stream.gcount());
+  }
+}
+
+// sorted, the iteration order of a directory is unspecified
+std::vector<std::filesystem::path> files_below(
+    const std::filesystem::path& directory) {
+  std::vector<std::filesystem::path> files;
+  if (std::filesystem::is_directory(directory)) {
+    for (const auto& entry :
+         std::filesystem::recursive_directory_iterator(directory)) {
+      if (entry.is_regular_file()) {
+        files.push_back(entry.path());
+      }
+    }
+  }
+  std::ranges::sort(files);
+  return files;
+}
+}  // namespace
+
+uint64_t StudyInputsHash(const std::filesystem::path& study_path) {
+  std::vector<std::filesystem::path> files;
+  if (std::filesystem::is_regular_file(study_path / "study.antares")) {
+    files.push_back(study_path / "study.antares");
+  }
+  for (const auto* directory : {"settings", "input"}) {
+    const auto directory_files = files_below(study_path / directory);
+    files.insert(files.end(), directory_files.begin(), directory_files.end());
+  }
+
+  uint64_t hash = FNV_OFFSET_BASIS;
+  for (const auto& file : files) {
+    // the name separates the contents of two consecutive files
+    const auto name = file.lexically_relative(study_path).generic_string();
+    hash_bytes(hash, name.c_str(), name.size() + 1);
+    hash_file(hash, file);
+  }
+  return hash;
+}
+
+std::filesystem::path RestoreSimulationOutput(
+    const std::filesystem::path& simulation_copy,
+    const std::filesystem::path& output_root) {
+  const auto now =
+      std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
+  std::ostringstream name;
+  name << std::put_time(std::localtime(&now), "%Y%m%d-%H%M%S") << "-snapshot";
+  auto destination = output_root / name.str();
+  for (int suffix(1); std::filesystem::exists(destination); ++suffix) {
+    destination = output_root / (name.str() + "-" + std::to_string(suffix));
+  }
+  std::filesystem::create_directories(destination);
+  std::filesystem::copy(simulation_copy, destination,
+                        std::filesystem::copy_options::recursive);
+  return destination;
+}
+
+LpsSnapshotCache::LpsSnapshotCache(std::filesystem::path directory)
+    : directory_(std::move(directory)) {}
+
+std::filesystem::path LpsSnapshotCache::snapshotPath(
+    uint64_t inputs_hash) const {
+  std::ostringstream name;
+  name << "lps-" << std::hex << std::setw(16) << std::setfill('0')
+       << inputs_hash << ".bin";
+  return directory_ / name.str();
+}
+
+std::filesystem::path LpsSnapshotCache::simulationCopyPath(
+    uint64_t inputs_hash) const {
+  auto path = snapshotPath(inputs_hash);
+  path.replace_extension(".output");
+  return path;
+}
+
+std::optional<LpsSnapshot> LpsSnapshotCache::load(uint64_t inputs_hash) const {
+  std::ifstream stream(snapshotPath(inputs_hash), std::ios::binary);
+  if (!stream) {
+    return std::nullopt;
+  }
+  try {
+    boost::archive::binary_iarchive archive(stream);
+    std::string magic;
+    unsigned int format_version = 0;
+    uint64_t hash = 0;
+    archive >> magic >> format_version >> hash;
+    if (magic != SNAPSHOT_MAGIC || format_version != SNAPSHOT_FORMAT_VERSION ||
+        hash != inputs_hash) {
+      return std::nullopt;
+    }
+    LpsSnapshot snapshot;
+    archive >> snapshot.extraction_time >> snapshot.lps;
+    snapshot.simulation_path = simulationCopyPath(inputs_hash);
+    if (!std::filesystem::is_directory(snapshot.simulation_path)) {
+      return std::nullopt;
+    }
+    return snapshot;
+  } catch (const std::exception&) {
+    // truncated or from another version of the library
+    return std::nullopt;
+  }
+}
+
+void LpsSnapshotCache::save(uint64_t inputs_hash,
+                            const Antares::Solver::LpsFromAntares& lps,
+                            const std::filesystem::path& simulation_path,
+                            double extraction_time) const {
+  std::filesystem::create_directories(directory_);
+  // the problem generation later writes into the simulation output, the
+  // snapshot keeps it as the simulation left it
+  const auto simulation_copy = simulationCopyPath(inputs_hash);
+  std::filesystem::remove_all(simulation_copy);
+  std::filesystem::copy(simulation_path, simulation_copy,
+                        std::filesystem::copy_options::recursive);
+
+  const auto snapshot_path = snapshotPath(inputs_hash);
+  // a run reading the cache never sees a partially written snapshot
+  auto temporary_path = snapshot_path;
+  temporary_path += ".tmp";
+  {
+    std::ofstream stream(temporary_path, std::ios::binary | std::ios::trunc);
+    boost::archive::binary_oarchive archive(stream);
+    archive << SNAPSHOT_MAGIC << SNAPSHOT_FORMAT_VERSION << inputs_hash
+            << extraction_time << lps;
+  }
+  std::filesystem::rename(temporary_path, snapshot_path);
+}
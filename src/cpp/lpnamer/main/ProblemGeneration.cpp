@@ -5,25 +5,21 @@
 #include <antares/api/solver.h>
 #include <ittnotify.h>
 
-#include <boost/archive/text_iarchive.hpp>
-#include <boost/archive/text_oarchive.hpp>
-#include <boost/serialization/map.hpp>
-#include <boost/serialization/serialization.hpp>
-#include <boost/serialization/string.hpp>
-#include <boost/serialization/vector.hpp>
-#include <execution>
 #include <filesystem>
 #include <iostream>
+#include <optional>
 #include <utility>
 
 #include "ActiveLinks.h"
 #include "AdditionalConstraints.h"
+#include "BoundedPipeline.h"
 #include "FileProblemsProviderAdapter.h"
 #include "GeneralDataReader.h"
 #include "LauncherHelpers.h"
 #include "LinkProblemsGenerator.h"
 #include "LogUtils.h"
 #include "LpFilesExtractor.h"
+#include "LpsSnapshot.h"
 #include "MPSFileWriter.h"
 #include "MasterGeneration.h"
 #include "MasterProblemBuilder.h"
@@ -40,151 +36,9 @@
 #include "XpansionProblemsFromAntaresProvider.h"
 #include "ZipProblemsProviderAdapter.h"
 #include "config.h"
-#include "include/memory.h"
 
 static const std::string LP_DIRNAME = "lp";
 
-namespace boost::serialization {
-template <class Archive>
-void serialize(Archive& ar, Antares::Solver::ConstantDataFromAntares& data, const unsigned int version) {
-        ar& data.VariablesCount;
-        ar& data.ConstraintesCount;
-        ar& data.CoeffCount;
-        ar& data.VariablesType;
-        ar& data.Mdeb;
-        ar& data.NotNullTermCount;
-        ar& data.ColumnIndexes;
-        ar& data.ConstraintsMatrixCoeff;
-        ar& data.VariablesMeaning;
-        ar& data.ConstraintsMeaning;
-}
-
-template <class Archive>
-void serialize(Archive& ar, Antares::Solver::WeeklyProblemId& data, const unsigned int version) {
-  ar& data.year;
-  ar& data.week;
-}
-
-
-template <class Archive>
-void serialize(Archive& ar, Antares::Solver::WeeklyDataFromAntares& data, const unsigned int version) {
-  ar& data.Direction;
-  ar& data.Xmax;
-  ar& data.Xmin;
-  ar& data.LinearCost;
-  ar& data.RHS;
-  ar& data.name;
-  ar& data.variables;
-  ar& data.constraints;
-}
-
-template <class Archive>
-void serialize(Archive& ar, Antares::Solver::LpsFromAntares& data, const unsigned int version) {
-        ar& data.constantProblemData;
-        ar& data.weeklyProblems;
-}
-}  // namespace boost::serialization
-
-namespace {
-std::uintmax_t disk_usage_percent(const std::filesystem::space_info& si,
-                                  bool is_privileged = false) noexcept
-{
-  if (constexpr std::uintmax_t X(-1);
-      si.capacity == 0 || si.free == 0 || si.available == 0 ||
-      si.capacity == X || si.free == X || si.available == X
-  )
-    return 100;
-
-  std::uintmax_t unused_space = si.free, capacity = si.capacity;
-  if (!is_privileged)
-  {
-    const std::uintmax_t privileged_only_space = si.free - si.available;
-    unused_space -= privileged_only_space;
-    capacity -= privileged_only_space;
-  }
-  const std::uintmax_t used_space{capacity - unused_space};
-  return 100 * used_space / capacity;
-}
-
-void print_disk_space_info(auto const& dirs, int width = 14)
-{
-  (std::cout << std::left).imbue(std::locale("en_US.UTF-8"));
-
-  for (const auto s : {"Capacity", "Free", "Available", "Use%", "Dir"})
-    std::cout << "│ " << std::setw(width) << s << ' ';
-
-  for (std::cout << '\n'; auto const& dir : dirs)
-  {
-    std::error_code ec;
-    const std::filesystem::space_info si = std::filesystem::space(dir, ec);
-    for (auto x : {si.capacity, si.free, si.available, disk_usage_percent(si)})
-      std::cout << "│ " << std::setw(width) << static_cast<std::intmax_t>(x / 1024.f /1024.f) << ' ';
-    std::cout << "│ " << dir << '\n';
-  }
-}
-
-struct self_mem {
-  long double vm_usage = 0.0;
-  long resident_set = 0.0;
-};
-self_mem process_mem_usage()
-{
-  self_mem mem;
-
-  // the two fields we want
-  unsigned long vsize;
-  long rss;
-  {
-    std::string ignore;
-    std::ifstream ifs("/proc/self/stat", std::ios_base::in);
-    ifs >> ignore >> ignore >> ignore >> ignore >> ignore >> ignore >> ignore >> ignore >> ignore >> ignore
-        >> ignore >> ignore >> ignore >> ignore >> ignore >> ignore >> ignore >> ignore >> ignore >> ignore
-        >> ignore >> ignore >> vsize >> rss;
-  }
-
-  long page_size_kb = sysconf(_SC_PAGE_SIZE) / 1024; // in case x86-64 is configured to use 2MB pages
-  return {vsize / 1024.0l / 1024.l, rss * page_size_kb};
-}
-static std::string study_dir = "";
-
-namespace fs = std::filesystem;
-std::uintmax_t calculate_directory_size(const fs::path& directory) {
-  std::uintmax_t total_size = 0;
-  std::error_code ec;
-
-  for (const auto& entry : fs::recursive_directory_iterator(directory, ec)) {
-    if (ec) {
-      std::cerr << "Error accessing " << entry.path() << ": " << ec.message() << "\n";
-      continue;
-    }
-    if (fs::is_regular_file(entry.status())) {
-      total_size += fs::file_size(entry.path(), ec);
-      if (ec) {
-        std::cerr << "Error getting size of " << entry.path() << ": " << ec.message() << "\n";
-      }
-    }
-  }
-
-  return total_size;
-}
-
-void memory() {
-  auto [dispo, total] = Memory::MemoryUsageGo();
-  auto [vm, rss] = process_mem_usage();
-  std::cout << "====================================\n";
-  std::cout << "Memory usage: " << dispo << "/" << total << "\n";
-  std::cout << "VM: " << vm << "Mb; RSS: " << rss << "\n";
-  std::cout << "------------------------------------\n";
-  using namespace std::string_literals;
-  const auto dirs = {"/scratch"s, "/tmp"s};
-  print_disk_space_info(dirs);
-  std::cout << "------------------------------------\n";
-  std::uintmax_t dir_size = calculate_directory_size(study_dir);
-  std::cout << "Total size of directory " << study_dir << " is " << dir_size / 1024.f / 1024.f << " Mo." << "\n";
-  std::cout << "====================================" << "\n";
-}
-}
-
 void CreateDirectories(const std::filesystem::path& output_path) {
   if (!std::filesystem::exists(output_path)) {
     std::filesystem::create_directories(output_path);
@@ -196,7 +50,7 @@ void CreateDirectories(const std::filesystem::path& output_path) {
 }
 
 ProblemGeneration::ProblemGeneration(ProblemGenerationOptions& options)
-    : options_(options) {
+    : options_(options), resource_monitor_(options.ResourceMonitorPeriod()) {
   if (!options_.StudyPath().empty()) {
     mode_ = SimulationInputMode::ANTARES_API;
   } else if (!options_.XpansionOutputDir().empty()) {
@@ -206,32 +60,40 @@ ProblemGeneration::ProblemGeneration(ProblemGenerationOptions& options)
   }
 }
 
+void ProblemGeneration::memory() const {
+  if (resource_monitor_.enabled()) {
+    std::cout << resource_monitor_.latest() << "\n";
+  }
+}
+
 std::filesystem::path ProblemGeneration::performAntaresSimulation() {
-//#ifdef SAVE
-//  auto results = Antares::API::PerformSimulation(options_.StudyPath());
-//  //Add parallel
-//  //Handle errors
-//  if (results.error) {
-//    std::cerr << "Error: " << results.error->reason << "\n";
-//    exit(1);
-//  }
-//
-//  lps_ = std::move(results.antares_problems);
-//  std::ofstream ofs("lps.txt");
-//  boost::archive::text_oarchive oa(ofs);
-//  oa << lps_;
-//  //TODO save simulation path
-//  return {results.simulationPath};
-//#else
-//  std::ifstream ifs("lps.txt");
-//  boost::archive::text_iarchive ia(ifs);
-//  ia >> lps_;
-//  return "/home/marechaljas/Téléchargements/study_1_integer/output/20240715-1416eco";
-//#endif
+  std::optional<LpsSnapshotCache> snapshots;
+  uint64_t inputs_hash = 0;
+  if (const auto snapshot_dir = options_.LpsSnapshotDir();
+      !snapshot_dir.empty()) {
+    Timer load_timer;
+    inputs_hash = StudyInputsHash(options_.StudyPath());
+    std::cout << "Study inputs hashed in " << load_timer.elapsed() << " s\n";
+    snapshots.emplace(snapshot_dir);
+    if (auto snapshot = snapshots->load(inputs_hash)) {
+      const auto simulation_path = RestoreSimulationOutput(
+          snapshot->simulation_path, options_.StudyPath() / "output");
+      std::cout << "Antares problems loaded from "
+                << snapshots->snapshotPath(inputs_hash) << " into "
+                << simulation_path << " in " << load_timer.elapsed()
+                << " s instead of a " << snapshot->extraction_time
+                << " s simulation\n";
+      lps_ = std::move(snapshot->lps);
+      return simulation_path;
+    }
+    std::cout << "No snapshot of the Antares problems for these inputs\n";
+  }
+
 {
   std::cout << "Memory usage before simulation:\n ";
   memory();
 }
+  Timer simulation_timer;
   auto results = Antares::API::PerformSimulation(options_.StudyPath());
 
   {
@@ -244,6 +106,22 @@ std::filesystem::path ProblemGeneration::performAntaresSimulation() {
     exit(1);
   }
   lps_ = std::move(results.antares_problems);
+  if (snapshots) {
+    const double extraction_time = simulation_timer.elapsed();
+    Timer save_timer;
+    // the snapshot only saves time on later runs, this one goes on without it
+    try {
+      snapshots->save(inputs_hash, lps_, results.simulationPath,
+                      extraction_time);
+      std::cout << "Antares problems saved to "
+                << snapshots->snapshotPath(inputs_hash) << " in "
+                << save_timer.elapsed() << " s\n";
+    } catch (const std::exception& e) {
+      std::cerr << "Warning: the Antares problems could not be saved to "
+                << snapshots->snapshotPath(inputs_hash) << ": " << e.what()
+                << "\n";
+    }
+  }
   return {results.simulationPath};
 }
 
@@ -255,7 +133,7 @@ std::filesystem::path ProblemGeneration::updateProblems() {
   if (mode_ == SimulationInputMode::ARCHIVE) {
     xpansion_output_dir =
         options_.deduceXpansionDirIfEmpty(xpansion_output_dir, archive_path);
-    study_dir = xpansion_output_dir.parent_path();
+    resource_monitor_.watch(xpansion_output_dir.parent_path());
 
   }
 
@@ -268,13 +146,12 @@ std::filesystem::path ProblemGeneration::updateProblems() {
     simulation_dir_ = options_.XpansionOutputDir();  // Legacy naming.
     // options_.XpansionOutputDir() point in fact to a simulation output from
     // antares
-    study_dir = simulation_dir_;
   }
 
   if (mode_ == SimulationInputMode::ANTARES_API ||
       mode_ == SimulationInputMode::FILE) {
     xpansion_output_dir = simulation_dir_;
-    study_dir = simulation_dir_;
+    resource_monitor_.watch(simulation_dir_);
   }
 
 
@@ -330,9 +207,10 @@ void ProblemGeneration::ExtractUtilsFiles(
 
 std::vector<ActiveLink> getLinks(
     const std::filesystem::path& xpansion_output_dir,
-    ProblemGenerationLog::ProblemGenerationLoggerSharedPointer& logger) {
+    ProblemGenerationLog::ProblemGenerationLoggerSharedPointer& logger,
+    const std::filesystem::path& profiles_cache_dir) {
   ActiveLinksBuilder linkBuilder =
-      get_link_builders(xpansion_output_dir, logger);
+      get_link_builders(xpansion_output_dir, logger, profiles_cache_dir);
   std::vector<ActiveLink> links = linkBuilder.getLinks();
   return links;
 }
@@ -355,37 +233,30 @@ void validateMasterFormulation(
   }
 }
 
-std::vector<std::shared_ptr<Problem>> ProblemGeneration::getXpansionProblems(
-    SolverLogManager& solver_log_manager, const std::string& solver_name,
+std::unique_ptr<IXpansionProblemsProvider>
+ProblemGeneration::getXpansionProblemsProvider(
     const std::vector<ProblemData>& mpsList, std::filesystem::path& lpDir_,
-    std::shared_ptr<ArchiveReader>& reader, bool with_archive = true,
-    const Antares::Solver::LpsFromAntares& lps = {}) {
+    std::shared_ptr<ArchiveReader>& reader,
+    const Antares::Solver::LpsFromAntares& lps) {
   std::vector<std::string> problem_names;
   std::transform(mpsList.begin(), mpsList.end(),
                  std::back_inserter(problem_names),
                  [](ProblemData const& data) { return data._problem_mps; });
   switch (mode_) {
-    case SimulationInputMode::FILE: {
-      auto adapter =
-          std::make_unique<FileProblemsProviderAdapter>(lpDir_, problem_names);
-      return adapter->provideProblems(solver_name, solver_log_manager);
-    }
-    case SimulationInputMode::ARCHIVE: {
-      auto adapter = std::make_unique<ZipProblemsProviderAdapter>(
-          lpDir_, reader, problem_names);
-      return adapter->provideProblems(solver_name, solver_log_manager);
-    }
-    case SimulationInputMode::ANTARES_API: {
-      auto adapter = std::make_unique<XpansionProblemsFromAntaresProvider>(lps);
-      return adapter->provideProblems(solver_name, solver_log_manager);
-    }
+    case SimulationInputMode::FILE:
+      return std::make_unique<FileProblemsProviderAdapter>(lpDir_,
+                                                           problem_names);
+    case SimulationInputMode::ARCHIVE:
+      return std::make_unique<ZipProblemsProviderAdapter>(lpDir_, reader,
+                                                          problem_names);
+    case SimulationInputMode::ANTARES_API:
+      return std::make_unique<XpansionProblemsFromAntaresProvider>(lps);
     default:
       // TODO : log
-      return {};
+      return nullptr;
   }
 }
 
-
 void ProblemGeneration::RunProblemGeneration(
     const std::filesystem::path& xpansion_output_dir,
     const std::string& master_formulation,
@@ -412,7 +283,8 @@ void ProblemGeneration::RunProblemGeneration(
   memory();
   ExtractUtilsFiles(antares_archive_path, xpansion_output_dir, logger);
 
-  std::vector<ActiveLink> links = getLinks(xpansion_output_dir, logger);
+  std::vector<ActiveLink> links =
+      getLinks(xpansion_output_dir, logger, options_.ProfilesCacheDir());
   std::cout << "Links ok" << "\n";
   memory();
   AdditionalConstraints additionalConstraints(logger);
@@ -441,9 +313,7 @@ void ProblemGeneration::RunProblemGeneration(
   memory();
   (*logger)(LogUtils::LOGLEVEL::INFO) << "Reading mps" << "\n";
   auto mpsList = files_mapper.MpsAndVariablesFilesVect();
-  auto [dispo, total] = Memory::MemoryUsageGo();
-  std::cout << "Memory usage: "
-            << dispo << "/" << total << "\n";
+  memory();
   (*logger)(LogUtils::LOGLEVEL::INFO) << "Reading mps done" << "\n";
   auto solver_log_manager = SolverLogManager(log_file_path);
   Couplings couplings;
@@ -459,31 +329,42 @@ void ProblemGeneration::RunProblemGeneration(
   memory();
   /* Main stuff */
 
-  std::vector<std::shared_ptr<Problem>> xpansion_problems =
-      getXpansionProblems(solver_log_manager, solver_name, mpsList, lpDir_,
-                          reader, !antares_archive_path.empty(), lps_);
-  lps_.weeklyProblems.clear();
-  lps_.constantProblemData = {};
-  (*logger)(LogUtils::LOGLEVEL::INFO) << "Problems read" << "\n";
-  memory();
-  std::vector<std::pair<std::shared_ptr<Problem>, ProblemData>>
-      problems_and_data;
-  for (int i = 0; i < xpansion_problems.size(); ++i) {
-    if (mode_ == SimulationInputMode::ANTARES_API) {
-      ProblemData data{xpansion_problems.at(i)->_name, {}};
-      problems_and_data.emplace_back(xpansion_problems.at(i), data);
-    } else {
-      xpansion_problems.at(i)->_name = mpsList.at(i)._problem_mps;
-      problems_and_data.emplace_back(xpansion_problems.at(i), mpsList.at(i));
-    }
-  }
+  auto problems_provider =
+      getXpansionProblemsProvider(mpsList, lpDir_, reader, lps_);
   (*logger)(LogUtils::LOGLEVEL::INFO) << "Start problem generation" << "\n";
   memory();
-  auto mps_file_writer = std::make_shared<MPSFileWriter>(lpDir_);
-  std::for_each(
-      std::execution::par, problems_and_data.begin(), problems_and_data.end(),
-      [&](const auto& problem_and_data) {
-        const auto& [problem, data] = problem_and_data;
+  auto mps_file_writer = std::make_shared<MPSFileWriter>(
+      lpDir_, compression_from_name(options_.MpsCompression()));
+  PipelineOptions pipeline_options;
+  pipeline_options.queue_depth = options_.PipelineQueueDepth();
+  pipeline_options.workers = options_.PipelineWorkers();
+  (*logger)(LogUtils::LOGLEVEL::INFO)
+      << "At most " << pipeline_options.max_items_in_flight()
+      << " problems in memory" << "\n";
+  auto* antares_provider =
+      dynamic_cast<XpansionProblemsFromAntaresProvider*>(
+          problems_provider.get());
+
+  using ProblemAndData = std::pair<std::shared_ptr<Problem>, ProblemData>;
+  const size_t problem_count =
+      problems_provider ? problems_provider->problemCount() : 0;
+  RunBoundedPipeline<ProblemAndData>(
+      problem_count, pipeline_options,
+      [&](size_t index) {
+        auto problem = problems_provider->provideProblem(index, solver_name,
+                                                         solver_log_manager);
+        if (mode_ == SimulationInputMode::ANTARES_API) {
+          // the translated problem is the only copy needed from now on. Only
+          // the mapped value changes, the map stays safe for other readers.
+          lps_.weeklyProblems.at(antares_provider->problemId(index)) = {};
+          ProblemData data{problem->_name, {}};
+          return ProblemAndData(std::move(problem), std::move(data));
+        }
+        problem->_name = mpsList.at(index)._problem_mps;
+        return ProblemAndData(std::move(problem), mpsList.at(index));
+      },
+      [&](ProblemAndData& problem_and_data) {
+        auto& [problem, data] = problem_and_data;
         std::cout << "Start " << data._problem_mps << "\n";
         std::cout << "Memory usage subproblem "<<
             data._problem_mps << " mcyear " << problem->McYear() << " :\n";
@@ -514,12 +395,19 @@ void ProblemGeneration::RunProblemGeneration(
             (*logger)(LogUtils::LOGLEVEL::ERR) << "Undefined mode";
             break;
         }
-        linkProblemsGenerator.treat(data._problem_mps, couplings, problem.get(),
-                                    variables_provider.get(),
-                                    mps_file_writer.get());
+        linkProblemsGenerator.modify(data._problem_mps, couplings,
+                                     problem.get(), variables_provider.get());
+      },
+      [&](ProblemAndData& problem_and_data) {
+        auto& [problem, data] = problem_and_data;
+        linkProblemsGenerator.write(problem.get(), mps_file_writer.get());
         std::cout << "End " << data._problem_mps << "\n";
-
       });
+  problems_provider.reset();
+  lps_.weeklyProblems.clear();
+  lps_.constantProblemData = {};
+  (*logger)(LogUtils::LOGLEVEL::INFO) << "Problems generated" << "\n";
+  memory();
 
   if (mode_ == SimulationInputMode::ARCHIVE) {
     reader->Close();
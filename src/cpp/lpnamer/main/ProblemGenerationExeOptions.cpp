@@ -1,4 +1,6 @@
 #include "ProblemGenerationExeOptions.h"
+
+#include "multisolver_interface/ProblemFileCompression.h"
 namespace po = boost::program_options;
 using namespace std::string_literals;
 
@@ -20,13 +22,37 @@ ProblemGenerationExeOptions::ProblemGenerationExeOptions()
       po::value<std::filesystem::path>(&weights_file_)->default_value(""),
       "user weights file")("unnamed-problems,n",
                            po::bool_switch(&unnamed_problems_),
-                           "use this option if unnamed problems are provided");
+                           "use this option if unnamed problems are provided")(
+      "compression",
+      po::value<std::string>(&mps_compression_)->default_value("none"),
+      "compression of the generated problems (none, gzip or zstd)")(
+      "queue-depth",
+      po::value<size_t>(&pipeline_queue_depth_)->default_value(4),
+      "problems waiting between the read, modify and write steps")(
+      "workers", po::value<size_t>(&pipeline_workers_)->default_value(0),
+      "threads of each step of the problem generation, 0 for every core")(
+      "lps-snapshot-dir",
+      po::value<std::filesystem::path>(&lps_snapshot_dir_),
+      "directory of the snapshots of the problems extracted from the Antares "
+      "study, reused while its inputs do not change (study mode only). The "
+      "inputs are read once on every run to detect their changes")(
+      "profiles-cache-dir",
+      po::value<std::filesystem::path>(&profiles_cache_dir_),
+      "directory of the binary copies of the link profiles, reused while "
+      "their content does not change. Copies no run has used for 30 days "
+      "are removed, the directory can be shared by several studies")(
+      "resource-monitor-period",
+      po::value<double>(&resource_monitor_period_)->default_value(1),
+      "seconds between two samples of the memory, cpu and disk usage, 0 to "
+      "disable them");
 }
 void ProblemGenerationExeOptions::Parse(unsigned int argc,
                                         const char* const* argv) {
   OptionsParser::Parse(argc, argv);
   auto log_location = LOGLOCATION;
   checkMandatoryOptions(log_location);
+  // throws on an unknown compression, before any problem is generated
+  compression_from_name(mps_compression_);
 }
 
 auto ProblemGenerationExeOptions::exclusiveMandatoryParameters() const {
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <antares/solver/lps/LpsFromAntares.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+
+/*!
+ *  \brief hash of the names and contents of the files read by an Antares
+ * simulation: study.antares, settings and input
+ *
+ * Every byte of these files is read, so each run with snapshots enabled pays
+ * one read of the study inputs, hit or miss. This is far below the simulation
+ * that a hit saves, but it grows with the time series of the study. Sizes and
+ * modification times are not used: a copied or restored study would miss.
+ */
+uint64_t StudyInputsHash(const std::filesystem::path& study_path);
+
+/*!
+ *  \brief copies the simulation output kept by a snapshot into a new
+ * directory of output_root, so that a run never writes into the output of a
+ * previous run. Returns the new directory.
+ */
+std::filesystem::path RestoreSimulationOutput(
+    const std::filesystem::path& simulation_copy,
+    const std::filesystem::path& output_root);
+
+struct LpsSnapshot {
+  Antares::Solver::LpsFromAntares lps;
+  // copy of the output of the simulation that produced the problems, taken
+  // before the problem generation wrote into it
+  std::filesystem::path simulation_path;
+  // duration of that simulation, in seconds
+  double extraction_time = 0;
+};
+
+/*!
+ *  \brief binary snapshots of the problems extracted from an Antares
+ * simulation, one file per hash of the study inputs
+ */
+class LpsSnapshotCache {
+ public:
+  explicit LpsSnapshotCache(std::filesystem::path directory);
+
+  [[nodiscard]] std::filesystem::path snapshotPath(uint64_t inputs_hash) const;
+  [[nodiscard]] std::filesystem::path simulationCopyPath(
+      uint64_t inputs_hash) const;
+
+  /*!
+   *  \brief nullopt when there is no usable snapshot for these inputs: none
+   * was saved, it is unreadable or its copy of the simulation output no
+   * longer exists
+   */
+  [[nodiscard]] std::optional<LpsSnapshot> load(uint64_t inputs_hash) const;
+
+  /*!
+   *  \brief keeps the problems and a copy of the simulation output, throws
+   * std::exception when either cannot be written
+   */
+  void save(uint64_t inputs_hash, const Antares::Solver::LpsFromAntares& lps,
+            const std::filesystem::path& simulation_path,
+            double extraction_time) const;
+
+ private:
+  std::filesystem::path directory_;
+};
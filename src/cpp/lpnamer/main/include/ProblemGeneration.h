@@ -13,9 +13,11 @@
 #include "../../model/Problem.h"
 #include "../../model/SimulationInputMode.h"
 #include "ArchiveReader.h"
+#include "IXpansionProblemsProvider.h"
 #include "ProblemGenerationExeOptions.h"
 #include "ProblemGenerationLogger.h"
 #include "ProblemGenerationOptions.h"
+#include "ResourceMonitor.h"
 #include "multisolver_interface/SolverAbstract.h"
 
 class ProblemGeneration {
@@ -44,13 +46,15 @@ class ProblemGeneration {
       const std::filesystem::path& antares_archive_path,
       const std::filesystem::path& xpansion_output_dir,
       ProblemGenerationLog::ProblemGenerationLoggerSharedPointer logger);
-  std::vector<std::shared_ptr<Problem>> getXpansionProblems(
-      SolverLogManager& solver_log_manager, const std::string& solver_name,
+  std::unique_ptr<IXpansionProblemsProvider> getXpansionProblemsProvider(
       const std::vector<ProblemData>& mpsList, std::filesystem::path& lpDir_,
-      std::shared_ptr<ArchiveReader>& reader, bool with_archive,
+      std::shared_ptr<ArchiveReader>& reader,
       const Antares::Solver::LpsFromAntares& lps);
   Antares::Solver::LpsFromAntares lps_;
   SimulationInputMode mode_ = SimulationInputMode::UNKOWN;
   virtual std::filesystem::path performAntaresSimulation();
   std::filesystem::path simulation_dir_;
+  ResourceMonitor resource_monitor_;
+  // logs the latest sample of the resource monitor
+  void memory() const;
 };
@@ -17,6 +17,12 @@ class ProblemGenerationExeOptions : public OptionsParser,
   std::vector<int> active_years_;
   bool unnamed_problems_ = false;
   std::filesystem::path study_path_;
+  std::string mps_compression_;
+  size_t pipeline_queue_depth_ = 4;
+  size_t pipeline_workers_ = 0;
+  std::filesystem::path lps_snapshot_dir_;
+  std::filesystem::path profiles_cache_dir_;
+  double resource_monitor_period_ = 1;
 
  public:
   ProblemGenerationExeOptions();
@@ -43,6 +49,24 @@ class ProblemGenerationExeOptions : public OptionsParser,
   [[nodiscard]] bool UnnamedProblems() const override {
     return unnamed_problems_;
   }
+  [[nodiscard]] std::string MpsCompression() const override {
+    return mps_compression_;
+  }
+  [[nodiscard]] size_t PipelineQueueDepth() const override {
+    return pipeline_queue_depth_;
+  }
+  [[nodiscard]] size_t PipelineWorkers() const override {
+    return pipeline_workers_;
+  }
+  [[nodiscard]] std::filesystem::path LpsSnapshotDir() const override {
+    return lps_snapshot_dir_;
+  }
+  [[nodiscard]] std::filesystem::path ProfilesCacheDir() const override {
+    return profiles_cache_dir_;
+  }
+  [[nodiscard]] double ResourceMonitorPeriod() const override {
+    return resource_monitor_period_;
+  }
 
   void Parse(unsigned int argc, const char *const *argv) override;
 
@@ -21,6 +21,12 @@ class ProblemGenerationOptions {
       std::filesystem::path xpansion_output_dir,
       const std::filesystem::path& archive_path) const = 0;
   [[nodiscard]] virtual std::filesystem::path StudyPath() const = 0;
+  [[nodiscard]] virtual std::string MpsCompression() const = 0;
+  [[nodiscard]] virtual size_t PipelineQueueDepth() const = 0;
+  [[nodiscard]] virtual size_t PipelineWorkers() const = 0;
+  [[nodiscard]] virtual std::filesystem::path LpsSnapshotDir() const = 0;
+  [[nodiscard]] virtual std::filesystem::path ProfilesCacheDir() const = 0;
+  [[nodiscard]] virtual double ResourceMonitorPeriod() const = 0;
 
   class ConflictingParameters
       : public LogUtils::XpansionError<std::runtime_error> {
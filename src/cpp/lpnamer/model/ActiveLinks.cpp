@@ -1,5 +1,6 @@
 #include "ActiveLinks.h"
 
+#include <algorithm>
 #include <limits>
 #include <unordered_set>
 #include <utility>
@@ -18,11 +19,13 @@ void ActiveLinksBuilder::addCandidate(const CandidateData& candidate_data) {
 
 ActiveLinksBuilder::ActiveLinksBuilder(
     std::vector<CandidateData> candidateList,
-    std::map<std::string, std::vector<LinkProfile>> profile_map,
+    std::map<std::string, SharedLinkProfiles> profile_map,
     DirectAccessScenarioToChronicleProvider scenario_to_chronicle_provider,
     ProblemGenerationLog::ProblemGenerationLoggerSharedPointer logger)
     : _candidateDatas(std::move(candidateList)),
       _profile_map(std::move(profile_map)),
+      default_profile_(std::make_shared<const std::vector<LinkProfile>>(
+          1, LinkProfile(logger))),
       scenario_to_chronicle_provider_(
           std::move(scenario_to_chronicle_provider)),
       logger_(logger) {
@@ -30,6 +33,27 @@ ActiveLinksBuilder::ActiveLinksBuilder(
   checkLinksValidity();
 }
 
+namespace {
+std::map<std::string, SharedLinkProfiles> share(
+    std::map<std::string, std::vector<LinkProfile>> profile_map) {
+  std::map<std::string, SharedLinkProfiles> shared_profiles;
+  for (auto& [name, profiles] : profile_map) {
+    shared_profiles[name] =
+        std::make_shared<const std::vector<LinkProfile>>(std::move(profiles));
+  }
+  return shared_profiles;
+}
+}  // namespace
+
+ActiveLinksBuilder::ActiveLinksBuilder(
+    std::vector<CandidateData> candidateList,
+    std::map<std::string, std::vector<LinkProfile>> profile_map,
+    DirectAccessScenarioToChronicleProvider scenario_to_chronicle_provider,
+    ProblemGenerationLog::ProblemGenerationLoggerSharedPointer logger)
+    : ActiveLinksBuilder(std::move(candidateList),
+                         share(std::move(profile_map)),
+                         std::move(scenario_to_chronicle_provider), logger) {}
+
 ActiveLinksBuilder::ActiveLinksBuilder(
     const std::vector<CandidateData>& candidateList,
     const std::map<std::string, std::vector<LinkProfile>>& profile_map,
@@ -160,14 +184,13 @@ void ActiveLinksBuilder::create_links() {
   }
 }
 
-std::vector<LinkProfile> ActiveLinksBuilder::getProfilesFromProfileMap(
+SharedLinkProfiles ActiveLinksBuilder::getProfilesFromProfileMap(
     const std::string& profile_name) const {
-  std::vector<LinkProfile> profiles;
-  if (_profile_map.find(profile_name) != _profile_map.end()) {
-    profiles = _profile_map.at(profile_name);
+  if (auto it = _profile_map.find(profile_name);
+      it != _profile_map.end() && it->second && !it->second->empty()) {
+    return it->second;
   }
-  if (profiles.empty()) return {LinkProfile(logger_)};
-  return profiles;
+  return default_profile_;
 }
 
 ActiveLink::ActiveLink(
@@ -181,9 +204,10 @@ ActiveLink::ActiveLink(
       _linkor(std::move(linkor)),
       _linkex(std::move(linkex)),
       _already_installed_capacity(already_installed_capacity),
-      logger_(logger) {
-  _already_installed_profile.emplace_back(logger_);
-}
+      _already_installed_profile(
+          std::make_shared<const std::vector<LinkProfile>>(
+              1, LinkProfile(logger))),
+      logger_(logger) {}
 
 ActiveLink::ActiveLink(
     int idLink, const std::string& linkName, const std::string& linkor,
@@ -194,15 +218,24 @@ ActiveLink::ActiveLink(
 
 void ActiveLink::setAlreadyInstalledLinkProfiles(
     const std::vector<LinkProfile>& linkProfile) {
-  _already_installed_profile = linkProfile;
+  _already_installed_profile =
+      std::make_shared<const std::vector<LinkProfile>>(linkProfile);
+}
+
+void ActiveLink::setAlreadyInstalledLinkProfiles(
+    SharedLinkProfiles linkProfile) {
+  _already_installed_profile = std::move(linkProfile);
 }
 
 void ActiveLink::addCandidate(
     const CandidateData& candidate_data,
     const std::vector<LinkProfile>& candidate_profile) {
-  Candidate candidate(candidate_data, candidate_profile);
+  _candidates.emplace_back(candidate_data, candidate_profile);
+}
 
-  _candidates.push_back(candidate);
+void ActiveLink::addCandidate(const CandidateData& candidate_data,
+                              SharedLinkProfiles candidate_profile) {
+  _candidates.emplace_back(candidate_data, std::move(candidate_profile));
 }
 
 const std::vector<Candidate>& ActiveLink::getCandidates() const {
@@ -210,28 +243,28 @@ const std::vector<Candidate>& ActiveLink::getCandidates() const {
 }
 
 double ActiveLink::already_installed_direct_profile(size_t timeStep) const {
-  return _already_installed_profile.at(0).getDirectProfile(timeStep);
+  return _already_installed_profile->at(0).getDirectProfile(timeStep);
 }
 
 double ActiveLink::already_installed_indirect_profile(size_t timeStep) const {
-  return _already_installed_profile.at(0).getIndirectProfile(timeStep);
+  return _already_installed_profile->at(0).getIndirectProfile(timeStep);
 }
 
 double ActiveLink::already_installed_direct_profile(size_t chronicle_number,
                                                     size_t timeStep) const {
   if (chronicle_number == 0) chronicle_number = 1;
-  if (chronicle_number > _already_installed_profile.size())
+  if (chronicle_number > _already_installed_profile->size())
     chronicle_number = 1;
-  return _already_installed_profile.at(chronicle_number - 1)
+  return _already_installed_profile->at(chronicle_number - 1)
       .getDirectProfile(timeStep);
 }
 
 double ActiveLink::already_installed_indirect_profile(size_t chronicle_number,
                                                       size_t timeStep) const {
   if (chronicle_number == 0) chronicle_number = 1;
-  if (chronicle_number > _already_installed_profile.size())
+  if (chronicle_number > _already_installed_profile->size())
     chronicle_number = 1;
-  return _already_installed_profile.at(chronicle_number - 1)
+  return _already_installed_profile->at(chronicle_number - 1)
       .getIndirectProfile(timeStep);
 }
 
@@ -249,12 +282,25 @@ const std::string& ActiveLink::linkor() const { return _linkor; }
 std::string ActiveLink::get_linkex() const { return _linkex; }
 const std::string& ActiveLink::linkex() const { return _linkex; }
 
+unsigned int ActiveLink::chronicle(unsigned int mc_year) const {
+  const auto it = mc_year_to_chronicle_.find(mc_year);
+  return it == mc_year_to_chronicle_.end() ? 0 : it->second;
+}
+
+unsigned long ActiveLink::max_number_of_chronicles() const {
+  unsigned long result = _already_installed_profile->size();
+  for (const auto& candidate : _candidates) {
+    result = std::max(result, candidate.number_of_chronicles());
+  }
+  return result;
+}
+
 unsigned long ActiveLink::number_of_chronicles() const {
   // We don't check for correctness of the number of chronicles across profiles
   // We assume that all profiles have either 1 chronicle (per default) or the
   // same N number of chronicles. We can have 1 installed chronicle and N
   // profile chronicle or vice versa
-  if (unsigned long number_of_chronicles = _already_installed_profile.size();
+  if (unsigned long number_of_chronicles = _already_installed_profile->size();
       number_of_chronicles > 1)
     return number_of_chronicles;
   if (auto candidates = getCandidates(); !candidates.empty()) {
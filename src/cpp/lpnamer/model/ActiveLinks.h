@@ -25,9 +25,12 @@ class ActiveLink {
 
   void setAlreadyInstalledLinkProfiles(
       const std::vector<LinkProfile>& linkProfile);
+  void setAlreadyInstalledLinkProfiles(SharedLinkProfiles linkProfile);
 
   void addCandidate(const CandidateData& candidate_data,
                     const std::vector<LinkProfile>& candidate_profile);
+  void addCandidate(const CandidateData& candidate_data,
+                    SharedLinkProfiles candidate_profile);
   [[nodiscard]] const std::vector<Candidate>& getCandidates() const;
 
   [[nodiscard]] double already_installed_direct_profile(size_t timeStep) const;
@@ -38,6 +41,10 @@ class ActiveLink {
   [[nodiscard]] double already_installed_indirect_profile(
       size_t chronicle_number, size_t timeStep) const;
 
+  [[nodiscard]] const SharedLinkProfiles& already_installed_profiles() const {
+    return _already_installed_profile;
+  }
+
   [[nodiscard]] unsigned get_idLink() const;
   [[nodiscard]] LinkName get_LinkName() const;
   [[nodiscard]] std::string get_linkor() const;
@@ -46,11 +53,21 @@ class ActiveLink {
   [[nodiscard]] const std::string& linkex() const;
   [[nodiscard]] double get_already_installed_capacity() const;
 
-  [[nodiscard]] std::map<unsigned int, unsigned int> McYearToChronicle() const {
+  [[nodiscard]] const std::map<unsigned int, unsigned int>& McYearToChronicle()
+      const {
     return mc_year_to_chronicle_;
   }
+  /*!
+   *  \brief chronicle of the given mc year, 0 when the year is not mapped
+   */
+  [[nodiscard]] unsigned int chronicle(unsigned int mc_year) const;
 
   [[nodiscard]] unsigned long number_of_chronicles() const;
+  /*!
+   *  \brief largest number of chronicles among the already installed profile
+   * and the candidates profiles. Beyond it, every profile uses its first one.
+   */
+  [[nodiscard]] unsigned long max_number_of_chronicles() const;
 
  private:
   std::map<unsigned, unsigned> mc_year_to_chronicle_;
@@ -61,13 +78,19 @@ class ActiveLink {
   // Sur le lien capacité à ne pas toucher
   double _already_installed_capacity = 1;
   // Profile de la capa
-  std::vector<LinkProfile> _already_installed_profile = {};
+  SharedLinkProfiles _already_installed_profile;
   std::vector<Candidate> _candidates = {};
   ProblemGenerationLog::ProblemGenerationLoggerSharedPointer logger_;
 };
 
 class ActiveLinksBuilder {
  public:
+  ActiveLinksBuilder(
+      std::vector<CandidateData> candidateList,
+      std::map<std::string, SharedLinkProfiles> profile_map,
+      DirectAccessScenarioToChronicleProvider scenario_to_chronicle_provider,
+      ProblemGenerationLog::ProblemGenerationLoggerSharedPointer logger);
+
   ActiveLinksBuilder(
       std::vector<CandidateData> candidateList,
       std::map<std::string, std::vector<LinkProfile>> profile_map,
@@ -124,15 +147,16 @@ class ActiveLinksBuilder {
       const LinkData& link_data, const LinkName& link_name) const;
   void create_links();
 
-  LinkProfile getProfileFromProfileMap(const std::string& profile_name) const;
-  std::vector<LinkProfile> getProfilesFromProfileMap(
+  SharedLinkProfiles getProfilesFromProfileMap(
       const std::string& profile_name) const;
 
   std::map<LinkName, LinkData> _links_data;
   std::unordered_map<LinkName, std::string> linkToAlreadyInstalledProfileName;
   std::unordered_map<LinkName, double> linkToAlreadyInstalledCapacity;
   const std::vector<CandidateData> _candidateDatas;
-  const std::map<std::string, std::vector<LinkProfile>> _profile_map;
+  const std::map<std::string, SharedLinkProfiles> _profile_map;
+  // profile of links and candidates without profile file
+  SharedLinkProfiles default_profile_;
   std::vector<ActiveLink> _links;
   DirectAccessScenarioToChronicleProvider scenario_to_chronicle_provider_;
   ProblemGenerationLog::ProblemGenerationLoggerSharedPointer logger_;
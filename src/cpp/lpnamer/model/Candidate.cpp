@@ -3,8 +3,7 @@
 #include <algorithm>
 #include <utility>
 
-Candidate::Candidate(const CandidateData& data,
-                     std::vector<LinkProfile> profile)
+Candidate::Candidate(const CandidateData& data, SharedLinkProfiles profile)
     : _profile(std::move(profile)),
       _name(data.name),
       _annual_cost_per_mw(data.annual_cost_per_mw),
@@ -12,12 +11,17 @@ Candidate::Candidate(const CandidateData& data,
       _unit_size(data.unit_size),
       _max_units(data.max_units) {}
 
+Candidate::Candidate(const CandidateData& data,
+                     std::vector<LinkProfile> profile)
+    : Candidate(data, std::make_shared<const std::vector<LinkProfile>>(
+                          std::move(profile))) {}
+
 double Candidate::directCapacityFactor(size_t timeStep) const {
-  return _profile.at(0).getDirectProfile(timeStep);
+  return _profile->at(0).getDirectProfile(timeStep);
 }
 
 double Candidate::indirectCapacityFactor(size_t timeStep) const {
-  return _profile.at(0).getIndirectProfile(timeStep);
+  return _profile->at(0).getIndirectProfile(timeStep);
 }
 
 double Candidate::directCapacityFactor(size_t chronicle_number,
@@ -30,21 +34,21 @@ double Candidate::directCapacityFactor(size_t chronicle_number,
    * [0,N-1] to return the proper profiles
    */
   if (chronicle_number == 0) {
-    return _profile.at(0).getDirectProfile(timeStep);
+    return _profile->at(0).getDirectProfile(timeStep);
   }
-  if (chronicle_number > _profile.size()) chronicle_number = 1;
+  if (chronicle_number > _profile->size()) chronicle_number = 1;
   // 1-based chronicle in 0 based vector
-  return _profile.at(chronicle_number - 1).getDirectProfile(timeStep);
+  return _profile->at(chronicle_number - 1).getDirectProfile(timeStep);
 }
 
 double Candidate::indirectCapacityFactor(size_t chronicle_number,
                                          size_t timeStep) const {
   if (chronicle_number == 0) {
-    return _profile.at(0).getIndirectProfile(timeStep);
+    return _profile->at(0).getIndirectProfile(timeStep);
   }
-  if (chronicle_number > _profile.size()) chronicle_number = 1;
+  if (chronicle_number > _profile->size()) chronicle_number = 1;
   // 1-based chronicle in 0 based vector
-  return _profile.at(chronicle_number - 1).getIndirectProfile(timeStep);
+  return _profile->at(chronicle_number - 1).getIndirectProfile(timeStep);
 }
 
 double Candidate::obj() const { return _annual_cost_per_mw; }
@@ -77,5 +81,5 @@ bool Candidate::hasNullProfile(unsigned int chronicle,
       });
 }
 unsigned long Candidate::number_of_chronicles() const {
-  return _profile.size();
+  return _profile->size();
 }
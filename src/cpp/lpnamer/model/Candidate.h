@@ -2,6 +2,7 @@
 #define ANTARESXPANSION_CANDIDATE_H
 
 #include "LinkProfile.h"
+#include "LinkProfileStore.h"
 #include "ProblemGenerationLogger.h"
 #include "StringManip.h"
 
@@ -33,6 +34,7 @@ struct CandidateData {
 class Candidate {
  public:
   Candidate() = default;
+  Candidate(const CandidateData& data, SharedLinkProfiles profile);
   Candidate(const CandidateData& data, std::vector<LinkProfile> profile);
 
   double directCapacityFactor(size_t timeStep) const;
@@ -57,9 +59,11 @@ class Candidate {
                       const std::set<int>& time_steps) const;
 
   [[nodiscard]] unsigned long number_of_chronicles() const;
+  [[nodiscard]] const SharedLinkProfiles& profiles() const { return _profile; }
 
  private:
-  std::vector<LinkProfile> _profile;
+  SharedLinkProfiles _profile =
+      std::make_shared<const std::vector<LinkProfile>>();
   std::string _name;
   double _annual_cost_per_mw;
   double _max_investment;
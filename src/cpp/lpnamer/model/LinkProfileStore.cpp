@@ -0,0 +1,48 @@
+#include "LinkProfileStore.h"
+
+SharedLinkProfiles LinkProfileStore::Find(const std::string& key) const {
+  std::lock_guard lock(mutex_);
+  if (auto it = profiles_.find(key); it != profiles_.end()) {
+    return it->second;
+  }
+  return nullptr;
+}
+
+SharedLinkProfiles LinkProfileStore::Insert(const std::string& key,
+                                            std::vector<LinkProfile> profiles) {
+  std::lock_guard lock(mutex_);
+  auto [it, inserted] = profiles_.try_emplace(key);
+  if (inserted) {
+    it->second =
+        std::make_shared<const std::vector<LinkProfile>>(std::move(profiles));
+  }
+  return it->second;
+}
+
+size_t LinkProfileStore::size() const {
+  std::lock_guard lock(mutex_);
+  return profiles_.size();
+}
+
+size_t LinkProfileStore::MemoryUsage() const {
+  std::lock_guard lock(mutex_);
+  size_t memory = 0;
+  for (const auto& [key, profiles] : profiles_) {
+    memory += ProfilesMemoryUsage(*profiles);
+  }
+  return memory;
+}
+
+std::string LinkProfileStore::Key(const std::string& direct_file,
+                                  const std::string& indirect_file) {
+  return direct_file + '\n' + indirect_file;
+}
+
+size_t ProfilesMemoryUsage(const std::vector<LinkProfile>& profiles) {
+  size_t memory = 0;
+  for (const auto& profile : profiles) {
+    memory += sizeof(double) * (profile.direct_link_profile.capacity() +
+                                profile.indirect_link_profile.capacity());
+  }
+  return memory;
+}
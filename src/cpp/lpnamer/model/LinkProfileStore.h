@@ -0,0 +1,60 @@
+#ifndef ANTARESXPANSION_LINKPROFILESTORE_H
+#define ANTARESXPANSION_LINKPROFILESTORE_H
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "LinkProfile.h"
+
+/*!
+ *  \brief immutable chronicles of a link profile, shared by every candidate
+ * and link using the same profile files
+ */
+using SharedLinkProfiles = std::shared_ptr<const std::vector<LinkProfile>>;
+
+/*!
+ *  \class LinkProfileStore
+ *  \brief Keeps each link profile once, keyed by the files it was read from.
+ * Profiles stay alive as long as a candidate or a link refers to them.
+ */
+class LinkProfileStore {
+ public:
+  /*!
+   *  \brief returns the stored profiles of key, nullptr if none
+   */
+  [[nodiscard]] SharedLinkProfiles Find(const std::string& key) const;
+
+  /*!
+   *  \brief stores profiles under key and returns the shared copy. If key is
+   * already stored, the existing profiles are returned and profiles dropped.
+   */
+  SharedLinkProfiles Insert(const std::string& key,
+                            std::vector<LinkProfile> profiles);
+
+  [[nodiscard]] size_t size() const;
+
+  /*!
+   *  \brief bytes used by the profile values of the store
+   */
+  [[nodiscard]] size_t MemoryUsage() const;
+
+  /*!
+   *  \brief key of the profiles read from a direct and an indirect file
+   */
+  static std::string Key(const std::string& direct_file,
+                         const std::string& indirect_file);
+
+ private:
+  mutable std::mutex mutex_;
+  std::map<std::string, SharedLinkProfiles> profiles_;
+};
+
+/*!
+ *  \brief bytes used by the values of profiles
+ */
+size_t ProfilesMemoryUsage(const std::vector<LinkProfile>& profiles);
+
+#endif  // ANTARESXPANSION_LINKPROFILESTORE_H
@@ -91,6 +91,21 @@ class Problem : public SolverAbstract {
   void get_ub(double *ub, int fisrt, int last) const override {
     solver_abstract_->get_ub(ub, fisrt, last);
   }
+  SparseMatrixView get_rows_view() const override {
+    return solver_abstract_->get_rows_view();
+  }
+  SparseMatrixView get_cols_view() const override {
+    return solver_abstract_->get_cols_view();
+  }
+  ArrayView<double> get_obj_view() const override {
+    return solver_abstract_->get_obj_view();
+  }
+  ArrayView<double> get_lb_view() const override {
+    return solver_abstract_->get_lb_view();
+  }
+  ArrayView<double> get_ub_view() const override {
+    return solver_abstract_->get_ub_view();
+  }
   [[nodiscard]] int get_row_index(const std::string &name) override {
     return solver_abstract_->get_row_index(name);
   }
@@ -112,6 +127,9 @@ class Problem : public SolverAbstract {
   void del_rows(int first, int last) override {
     solver_abstract_->del_rows(first, last);
   }
+  void del_cols(int first, int last) override {
+    solver_abstract_->del_cols(first, last);
+  }
   void add_rows(int newrows, int newnz, const char *qrtype, const double *rhs,
                 const double *range, const int *mstart, const int *mclind,
                 const double *dmatval,
@@ -162,6 +180,10 @@ class Problem : public SolverAbstract {
   }
   int solve_lp() override { return solver_abstract_->solve_lp(); }
   int solve_mip() override { return solver_abstract_->solve_mip(); }
+  void set_mip_start(const std::vector<int> &mindex,
+                     const std::vector<double> &values) override {
+    solver_abstract_->set_mip_start(mindex, values);
+  }
   void get_basis(int *rstatus, int *cstatus) const override {
     solver_abstract_->get_basis(rstatus, cstatus);
   }
@@ -193,6 +215,15 @@ class Problem : public SolverAbstract {
   void set_optimality_gap(double gap) override {
     solver_abstract_->set_optimality_gap(gap);
   }
+  void set_mip_relative_gap(double gap) override {
+    solver_abstract_->set_mip_relative_gap(gap);
+  }
+  void set_dual_tolerance(double tolerance) override {
+    solver_abstract_->set_dual_tolerance(tolerance);
+  }
+  void set_lazy_constraint_callback(LazyConstraintCallback callback) override {
+    solver_abstract_->set_lazy_constraint_callback(std::move(callback));
+  }
   void set_simplex_iter(int iter) override {
     solver_abstract_->set_simplex_iter(iter);
   }
@@ -11,46 +11,49 @@
 #include "multisolver_interface/SolverFactory.h"
 #include "solver_utils.h"
 
-/**
- *
- * @Note: In case of performance issue we can accept non-const lps and work on
- * references to constant and hebdo parts
- */
+AntaresConstantProblemView::AntaresConstantProblemView(
+    const Antares::Solver::ConstantDataFromAntares& constant)
+    : constant(constant),
+      row_starts(reinterpret_cast<const int*>(constant.Mdeb.data()),
+                 constant.Mdeb.size()),
+      column_indexes(
+          reinterpret_cast<const int*>(constant.ColumnIndexes.data()),
+          constant.ColumnIndexes.size()),
+      column_starts(constant.VariablesCount, 0) {}
+
 std::shared_ptr<Problem>
 AntaresProblemToXpansionProblemTranslator::translateToXpansionProblem(
     const Antares::Solver::LpsFromAntares& lps, unsigned int year, unsigned int week,
     const std::string& solver_name, SolverLogManager& solver_log_manager) {
+  return translateToXpansionProblem(
+      AntaresConstantProblemView(lps.constantProblemData),
+      lps.weeklyProblems.at({year, week}), solver_name, solver_log_manager);
+}
+
+std::shared_ptr<Problem>
+AntaresProblemToXpansionProblemTranslator::translateToXpansionProblem(
+    const AntaresConstantProblemView& constant_view,
+    const Antares::Solver::WeeklyDataFromAntares& hebdo,
+    const std::string& solver_name, SolverLogManager& solver_log_manager) {
   SolverFactory factory;
   auto problem = std::make_shared<Problem>(
       factory.create_solver(solver_name, solver_log_manager));
-  auto constant = lps.constantProblemData;
-  auto hebdo = lps.weeklyProblems.at({year, week});
+  const auto& constant = constant_view.constant;
   problem->_name = hebdo.name;
 
-  std::vector<int> tmp(constant.VariablesCount, 0);
-  std::vector<char> coltypes(constant.VariablesCount, 'C');
-
-  //roundTo10Digit(constant, hebdo);
-
   problem->add_cols(constant.VariablesCount, 0, hebdo.LinearCost.data(),
-                    tmp.data(), {}, {}, hebdo.Xmin.data(), hebdo.Xmax.data());
+                    constant_view.column_starts.data(), {}, {},
+                    hebdo.Xmin.data(), hebdo.Xmax.data());
 
-  std::span<char> signs(hebdo.Direction.data(), hebdo.Direction.size());
-  auto LEG_vector = convertSignToLEG(signs);
-  problem->add_rows(
-      constant.ConstraintesCount, constant.CoeffCount,
-      convertSignToLEG(signs).data(), hebdo.RHS.data(),
-      nullptr, reinterpret_cast<const int *>(constant.Mdeb.data()), reinterpret_cast<const int *>(constant.ColumnIndexes.data()),
-      constant.ConstraintsMatrixCoeff.data(), {});
+  const auto LEG_vector = convertSignToLEG(hebdo.Direction);
+  problem->add_rows(constant.ConstraintesCount, constant.CoeffCount,
+                    LEG_vector.data(), hebdo.RHS.data(), nullptr,
+                    constant_view.row_starts.data(),
+                    constant_view.column_indexes.data(),
+                    constant.ConstraintsMatrixCoeff.data(), hebdo.constraints);
   for (int i = 0; i < constant.VariablesCount; ++i) {
     problem->chg_col_name(i, hebdo.variables[i]);
   }
-  for (int i = 0; i < constant.ConstraintesCount; ++i) {
-    problem->chg_row_name(i, hebdo.constraints[i]);
-  }
-  auto rows = problem->get_nrows();
-  auto cols = problem->get_ncols();
-  auto elem = problem->get_nelems();
   // On peut ajouter la partie qui renomme les variables ici si on stocke les
   // données du type de variables dans ConstantDataFromAntares, i.e. en
   // définissant une autre implémentation de IProblemVariablesProviderPort
@@ -73,8 +76,9 @@ void AntaresProblemToXpansionProblemTranslator::roundTo10Digit(
 }
 
 std::vector<char> AntaresProblemToXpansionProblemTranslator::convertSignToLEG(
-    std::span<char> data) {
+    std::span<const char> data) {
   std::vector<char> LEG_vector;
+  LEG_vector.reserve(data.size());
   //Exclude final '\0' character
   std::ranges::transform(data, std::back_inserter(LEG_vector), [](char c) {
     if ('=' == c) {
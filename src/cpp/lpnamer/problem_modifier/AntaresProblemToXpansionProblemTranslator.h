@@ -10,12 +10,35 @@
 
 #include "../model/Problem.h"
 
+/*!
+ *  \brief read-only view of the data shared by every weekly problem, built
+ * once and used by all the translations
+ */
+struct AntaresConstantProblemView {
+  explicit AntaresConstantProblemView(
+      const Antares::Solver::ConstantDataFromAntares& constant);
+
+  const Antares::Solver::ConstantDataFromAntares& constant;
+  std::span<const int> row_starts;
+  std::span<const int> column_indexes;
+  // columns are added without coefficients, the matrix comes with the rows
+  std::vector<int> column_starts;
+};
+
 class AntaresProblemToXpansionProblemTranslator {
  public:
   [[nodiscard]] static std::shared_ptr<Problem> translateToXpansionProblem(
       const Antares::Solver::LpsFromAntares& lps, unsigned int year, unsigned int week,
       const std::string& solver_name, SolverLogManager& solver_log_manager);
-  static std::vector<char> convertSignToLEG(std::span<char> data);
+  /*!
+   *  \brief neither the constant nor the weekly data are copied, several
+   * weeks can be translated concurrently from the same view
+   */
+  [[nodiscard]] static std::shared_ptr<Problem> translateToXpansionProblem(
+      const AntaresConstantProblemView& constant,
+      const Antares::Solver::WeeklyDataFromAntares& hebdo,
+      const std::string& solver_name, SolverLogManager& solver_log_manager);
+  static std::vector<char> convertSignToLEG(std::span<const char> data);
   static void roundTo10Digit(Antares::Solver::ConstantDataFromAntares& constant,
                              Antares::Solver::WeeklyDataFromAntares& hebdo);
 };
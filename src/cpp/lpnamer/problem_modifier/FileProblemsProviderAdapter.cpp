@@ -24,6 +24,18 @@ FileProblemsProviderAdapter::provideProblems(
                  });
   return problems;
 }
+size_t FileProblemsProviderAdapter::problemCount() const {
+  return problem_names_.size();
+}
+
+std::shared_ptr<Problem> FileProblemsProviderAdapter::provideProblem(
+    size_t index, const std::string& solver_name,
+    SolverLogManager& solver_log_manager) const {
+  FileProblemProviderAdapter problem_provider(lp_dir_,
+                                              problem_names_.at(index));
+  return problem_provider.provide_problem(solver_name, solver_log_manager);
+}
+
 FileProblemsProviderAdapter::FileProblemsProviderAdapter(
     std::filesystem::path lp_dir, std::vector<std::string> problem_names)
     : lp_dir_(lp_dir), problem_names_(problem_names) {}
@@ -12,4 +12,14 @@ class IXpansionProblemsProvider {
   [[nodiscard]] virtual std::vector<std::shared_ptr<Problem>> provideProblems(
       const std::string& solver_name,
       SolverLogManager& solver_log_manager) const = 0;
+  /*!
+   *  \brief number of problems, to provide them one at a time
+   */
+  [[nodiscard]] virtual size_t problemCount() const = 0;
+  /*!
+   *  \brief the index-th problem of provideProblems, alone
+   */
+  [[nodiscard]] virtual std::shared_ptr<Problem> provideProblem(
+      size_t index, const std::string& solver_name,
+      SolverLogManager& solver_log_manager) const = 0;
 };
@@ -139,7 +139,8 @@ void addBinaryVariables(
 
 ActiveLinksBuilder get_link_builders(
     const std::filesystem::path &xpansion_output_dir,
-    ProblemGenerationLog::ProblemGenerationLoggerSharedPointer logger) {
+    ProblemGenerationLog::ProblemGenerationLoggerSharedPointer logger,
+    const std::filesystem::path &profiles_cache_dir) {
   const auto area_file_name = xpansion_output_dir / "area.txt";
 
   const auto interco_file_name = xpansion_output_dir / "interco.txt";
@@ -157,8 +158,10 @@ ActiveLinksBuilder get_link_builders(
   // Instantiation of candidates
   const auto &candidatesDatas =
       candidateReader.readCandidateData(candidates_file_name);
-  const auto &mapLinkProfile = LinkProfileReader(logger).getLinkProfileMap(
-      capacity_folder, candidatesDatas);
+  LinkProfileReader profile_reader(logger);
+  profile_reader.setCacheDirectory(profiles_cache_dir);
+  const auto &mapLinkProfile =
+      profile_reader.getLinkProfileMap(capacity_folder, candidatesDatas);
 
   return ActiveLinksBuilder(
       candidatesDatas, mapLinkProfile,
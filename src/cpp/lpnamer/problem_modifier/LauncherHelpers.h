@@ -52,8 +52,12 @@ void addBinaryVariables(
 /**
  * \brief return Active Links Builder
  * \param root  path corresponding to the path to the simulation output
- * directory containing the lp directory \return ActiveLinksBuilder object
+ * directory containing the lp directory
+ * \param profiles_cache_dir  directory of the binary copies of the link
+ * profiles, empty to parse the profiles every time
+ * \return ActiveLinksBuilder object
  */
 ActiveLinksBuilder get_link_builders(
     const std::filesystem::path& xpansion_output_dir,
-    ProblemGenerationLog::ProblemGenerationLoggerSharedPointer logger);
\ No newline at end of file
+    ProblemGenerationLog::ProblemGenerationLoggerSharedPointer logger,
+    const std::filesystem::path& profiles_cache_dir = {});
\ No newline at end of file
@@ -0,0 +1,83 @@
+#include "LinkCoefficientTables.h"
+
+#include "LinkProfile.h"
+
+namespace {
+constexpr size_t BITS_PER_WORD = 64;
+
+// same projection of the chronicle as Candidate::directCapacityFactor and
+// ActiveLink::already_installed_direct_profile
+const LinkProfile& profile_of(const std::vector<LinkProfile>& profiles,
+                              unsigned int chronicle) {
+  if (chronicle == 0 || chronicle > profiles.size()) {
+    return profiles.at(0);
+  }
+  return profiles.at(chronicle - 1);
+}
+
+double value_at(const std::vector<double>& profile, size_t time_step) {
+  return time_step < profile.size() ? profile[time_step] : 0.0;
+}
+}  // namespace
+
+LinkCoefficientTable::LinkCoefficientTable(const ActiveLink& link,
+                                           unsigned int chronicle)
+    : n_candidates_(link.getCandidates().size()),
+      words_per_time_step_((n_candidates_ + BITS_PER_WORD - 1) / BITS_PER_WORD),
+      installed_direct_(NUMBER_OF_HOUR_PER_YEAR),
+      installed_indirect_(NUMBER_OF_HOUR_PER_YEAR),
+      direct_(NUMBER_OF_HOUR_PER_YEAR * n_candidates_),
+      indirect_(NUMBER_OF_HOUR_PER_YEAR * n_candidates_),
+      not_null_(NUMBER_OF_HOUR_PER_YEAR * words_per_time_step_, 0) {
+  const double already_installed_capacity =
+      link.get_already_installed_capacity();
+  const auto& installed =
+      profile_of(*link.already_installed_profiles(), chronicle);
+  for (size_t time_step(0); time_step < NUMBER_OF_HOUR_PER_YEAR; ++time_step) {
+    installed_direct_[time_step] =
+        already_installed_capacity *
+        value_at(installed.direct_link_profile, time_step);
+    installed_indirect_[time_step] =
+        already_installed_capacity *
+        value_at(installed.indirect_link_profile, time_step);
+  }
+
+  const auto& candidates = link.getCandidates();
+  for (size_t candidate(0); candidate < n_candidates_; ++candidate) {
+    const auto& profile =
+        profile_of(*candidates[candidate].profiles(), chronicle);
+    for (size_t time_step(0); time_step < NUMBER_OF_HOUR_PER_YEAR;
+         ++time_step) {
+      const double direct = value_at(profile.direct_link_profile, time_step);
+      const double indirect =
+          value_at(profile.indirect_link_profile, time_step);
+      direct_[time_step * n_candidates_ + candidate] = direct;
+      indirect_[time_step * n_candidates_ + candidate] = indirect;
+      if (direct != 0.0 || indirect != 0.0) {
+        not_null_[time_step * words_per_time_step_ +
+                  candidate / BITS_PER_WORD] |= uint64_t{1}
+                                                << (candidate % BITS_PER_WORD);
+      }
+    }
+  }
+}
+
+const LinkCoefficientTable& LinkCoefficientTables::get(const ActiveLink& link,
+                                                       unsigned int chronicle) {
+  // every profile falls back to its first chronicle beyond its size: all
+  // these chronicles share the table of the first one
+  if (chronicle == 0 || chronicle > link.max_number_of_chronicles()) {
+    chronicle = 1;
+  }
+  std::lock_guard guard(mutex_);
+  auto& table = tables_[{link.get_idLink(), chronicle}];
+  if (!table) {
+    table = std::make_unique<const LinkCoefficientTable>(link, chronicle);
+  }
+  return *table;
+}
+
+size_t LinkCoefficientTables::size() const {
+  std::lock_guard guard(mutex_);
+  return tables_.size();
+}
@@ -0,0 +1,93 @@
+#ifndef ANTARESXPANSION_LINKCOEFFICIENTTABLES_H
+#define ANTARESXPANSION_LINKCOEFFICIENTTABLES_H
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "ActiveLinks.h"
+
+/*!
+ *  \brief coefficients of the profile constraints of one link for one
+ * chronicle, laid out by time step so that building the rows of a problem
+ * only walks contiguous memory
+ */
+class LinkCoefficientTable {
+ public:
+  LinkCoefficientTable(const ActiveLink& link, unsigned int chronicle);
+
+  [[nodiscard]] size_t number_of_candidates() const { return n_candidates_; }
+
+  /*!
+   *  \brief already installed capacity times its profile at time_step
+   */
+  [[nodiscard]] double installed_direct(size_t time_step) const {
+    return installed_direct_[time_step];
+  }
+  [[nodiscard]] double installed_indirect(size_t time_step) const {
+    return installed_indirect_[time_step];
+  }
+  /*!
+   *  \brief capacity factors of every candidate of the link at time_step,
+   * in the order of ActiveLink::getCandidates()
+   */
+  [[nodiscard]] const double* direct(size_t time_step) const {
+    return direct_.data() + time_step * n_candidates_;
+  }
+  [[nodiscard]] const double* indirect(size_t time_step) const {
+    return indirect_.data() + time_step * n_candidates_;
+  }
+  /*!
+   *  \brief true when one of the profiles of the candidate is not null on one
+   * of the time steps
+   */
+  template <class TimeSteps>
+  [[nodiscard]] std::vector<bool> not_null_candidates(
+      const TimeSteps& time_steps) const {
+    std::vector<uint64_t> not_null(words_per_time_step_, 0);
+    for (const auto time_step : time_steps) {
+      const auto* words = not_null_.data() + time_step * words_per_time_step_;
+      for (size_t word(0); word < words_per_time_step_; ++word) {
+        not_null[word] |= words[word];
+      }
+    }
+    std::vector<bool> result(n_candidates_);
+    for (size_t candidate(0); candidate < n_candidates_; ++candidate) {
+      result[candidate] = (not_null[candidate / 64] >> (candidate % 64)) & 1U;
+    }
+    return result;
+  }
+
+ private:
+  size_t n_candidates_;
+  size_t words_per_time_step_;
+  std::vector<double> installed_direct_;
+  std::vector<double> installed_indirect_;
+  std::vector<double> direct_;
+  std::vector<double> indirect_;
+  std::vector<uint64_t> not_null_;
+};
+
+/*!
+ *  \brief tables of every (link, chronicle) met by the problems, computed the
+ * first time they are needed and then shared by every problem of the same mc
+ * year. Thread safe.
+ */
+class LinkCoefficientTables {
+ public:
+  const LinkCoefficientTable& get(const ActiveLink& link,
+                                  unsigned int chronicle);
+
+  [[nodiscard]] size_t size() const;
+
+ private:
+  mutable std::mutex mutex_;
+  std::map<std::pair<unsigned int, unsigned int>,
+           std::unique_ptr<const LinkCoefficientTable>>
+      tables_;
+};
+
+#endif  // ANTARESXPANSION_LINKCOEFFICIENTTABLES_H
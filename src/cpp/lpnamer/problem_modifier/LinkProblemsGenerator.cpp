@@ -1,7 +1,6 @@
 #include "LinkProblemsGenerator.h"
 
 #include <algorithm>
-#include <execution>
 #include <utility>
 
 #include "IProblemProviderPort.h"
@@ -39,12 +38,19 @@ void LinkProblemsGenerator::treat(
 void LinkProblemsGenerator::treat(
     const std::string &problem_name, Couplings &couplings, Problem *problem,
     IProblemVariablesProviderPort *variable_provider, IProblemWriter *writer) {
+  modify(problem_name, couplings, problem, variable_provider);
+  write(problem, writer);
+}
+
+void LinkProblemsGenerator::modify(
+    const std::string &problem_name, Couplings &couplings, Problem *problem,
+    IProblemVariablesProviderPort *variable_provider) {
   ProblemVariables problem_variables = variable_provider->Provide();
 
   if (rename_problems_) {
     solver_rename_vars(problem, problem_variables.variable_names);
   }
-  auto problem_modifier = ProblemModifier(logger_);
+  auto problem_modifier = ProblemModifier(logger_, coefficient_tables_);
   problem_modifier.changeProblem(problem, _links, problem_variables.ntc_columns,
                                  problem_variables.direct_cost_columns,
                                  problem_variables.indirect_cost_columns);
@@ -59,6 +65,10 @@ void LinkProblemsGenerator::treat(
       }
     }
   }
+}
+
+void LinkProblemsGenerator::write(Problem *problem,
+                                  IProblemWriter *writer) const {
   auto const lp_mps_name = lpDir_ / problem->_name;
   problem->_name = lp_mps_name.string();
   std::filesystem::remove(lp_mps_name);
@@ -68,25 +78,32 @@ void LinkProblemsGenerator::treat(
 void LinkProblemsGenerator::treatloop(const std::filesystem::path &root,
                                       Couplings &couplings,
                                       const std::vector<ProblemData> &mps_list,
-                                      IProblemWriter *writer) {
-  std::for_each(
-      std::execution::par, mps_list.begin(), mps_list.end(),
-      [&](const auto &mps) {
-        auto adapter = std::make_unique<MPSFileProblemProviderAdapter>(
-            root, mps._problem_mps);
-        auto problem =
-            adapter->provide_problem(_solver_name, solver_log_manager_);
+                                      IProblemWriter *writer,
+                                      const PipelineOptions &pipeline_options) {
+  struct LoadedProblem {
+    const ProblemData *data;
+    std::shared_ptr<Problem> problem;
+  };
+  RunBoundedPipeline<LoadedProblem>(
+      mps_list.size(), pipeline_options,
+      [&](size_t index) {
+        const auto &mps = mps_list[index];
+        MPSFileProblemProviderAdapter adapter(root, mps._problem_mps);
+        return LoadedProblem{
+            &mps, adapter.provide_problem(_solver_name, solver_log_manager_)};
+      },
+      [&](LoadedProblem &loaded) {
         std::unique_ptr<IProblemVariablesProviderPort> variables_provider;
         if (rename_problems_) {
           variables_provider = std::make_unique<ProblemVariablesFileAdapter>(
-              mps, _links, logger_, root);
+              *loaded.data, _links, logger_, root);
         } else {
           variables_provider =
               std::make_unique<ProblemVariablesFromProblemAdapter>(
-                  problem, _links, logger_);
+                  loaded.problem, _links, logger_);
         }
-
-        treat(mps._problem_mps, couplings, problem.get(),
-              variables_provider.get(), writer);
-      });
+        modify(loaded.data->_problem_mps, couplings, loaded.problem.get(),
+               variables_provider.get());
+      },
+      [&](LoadedProblem &loaded) { write(loaded.problem.get(), writer); });
 }
@@ -9,6 +9,7 @@
 
 #include "ArchiveReader.h"
 #include "ArchiveWriter.h"
+#include "BoundedPipeline.h"
 #include "FileInBuffer.h"
 #include "IProblemProviderPort.h"
 #include "IProblemVariablesProviderPort.h"
@@ -40,9 +41,14 @@ class LinkProblemsGenerator {
         rename_problems_(rename_problems),
         solver_log_manager_(solver_log_manager) {}
 
+  /*!
+   *  \brief reads, modifies and writes the problems of mps_list through a
+   * bounded pipeline: only a few problems are in memory at the same time
+   */
   void treatloop(const std::filesystem::path& root, Couplings& couplings,
                  const std::vector<ProblemData>& mps_list,
-                 IProblemWriter* writer);
+                 IProblemWriter* writer,
+                 const PipelineOptions& pipeline_options = {});
   void treat(const std::string& problem_name, Couplings& couplings,
              Problem* problem, IProblemVariablesProviderPort* variable_provider,
              IProblemWriter* writer);
@@ -50,6 +56,13 @@ class LinkProblemsGenerator {
              IProblemProviderPort* problem_provider,
              IProblemVariablesProviderPort* variable_provider,
              IProblemWriter* writer);
+  /*!
+   *  \brief adds the candidates to the problem and records its couplings
+   */
+  void modify(const std::string& problem_name, Couplings& couplings,
+              Problem* problem,
+              IProblemVariablesProviderPort* variable_provider);
+  void write(Problem* problem, IProblemWriter* writer) const;
 
  private:
   const std::vector<ActiveLink>& _links;
@@ -57,6 +70,8 @@ class LinkProblemsGenerator {
   std::filesystem::path lpDir_ = "";
   ProblemGenerationLog::ProblemGenerationLoggerSharedPointer logger_;
   mutable std::mutex coupling_mutex_;
+  std::shared_ptr<LinkCoefficientTables> coefficient_tables_ =
+      std::make_shared<LinkCoefficientTables>();
   bool rename_problems_ = false;
   SolverLogManager& solver_log_manager_;
 };
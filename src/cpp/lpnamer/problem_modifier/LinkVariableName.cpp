@@ -0,0 +1,109 @@
+#include "LinkVariableName.h"
+
+#include <algorithm>
+#include <charconv>
+
+namespace {
+constexpr std::string_view SEPARATOR = "::";
+constexpr std::string_view AREA_SEPARATOR = "$$";
+constexpr char WITHESPACESUBSTITUTE = '*';
+
+constexpr std::string_view NTC_VARIABLE_NAME = "NTCDirect";
+constexpr std::string_view COST_ORIGIN_VARIABLE_NAME = "IntercoDirectCost";
+constexpr std::string_view COST_EXTREMITE_VARIABLE_NAME =
+    "IntercoIndirectCost";
+
+LinkVariableType TypeOf(std::string_view variable) {
+  if (variable == NTC_VARIABLE_NAME) {
+    return LinkVariableType::NTC;
+  }
+  if (variable == COST_ORIGIN_VARIABLE_NAME) {
+    return LinkVariableType::DIRECT_COST;
+  }
+  if (variable == COST_EXTREMITE_VARIABLE_NAME) {
+    return LinkVariableType::INDIRECT_COST;
+  }
+  return LinkVariableType::NONE;
+}
+
+// input = X<Y>, returns Y
+bool BetweenChevrons(std::string_view input, std::string_view& result) {
+  const auto open = input.find('<');
+  if (open == std::string_view::npos) {
+    return false;
+  }
+  const auto close = input.find('>', open + 1);
+  result = input.substr(open + 1, close == std::string_view::npos
+                                      ? std::string_view::npos
+                                      : close - open - 1);
+  return true;
+}
+
+bool IsMatchable(const std::string& area) {
+  return area.find(WITHESPACESUBSTITUTE) == std::string::npos &&
+         area.find(AREA_SEPARATOR) == std::string::npos;
+}
+
+std::string Substituted(const std::string& area) {
+  std::string result = area;
+  std::replace(result.begin(), result.end(), ' ', WITHESPACESUBSTITUTE);
+  return result;
+}
+}  // namespace
+
+LinkVariableName ParseLinkVariableName(std::string_view name) {
+  LinkVariableName result;
+  const auto variable_end = name.find(SEPARATOR);
+  if (variable_end == std::string_view::npos) {
+    return result;
+  }
+  const auto type = TypeOf(name.substr(0, variable_end));
+  if (type == LinkVariableType::NONE) {
+    return result;
+  }
+
+  // link<area1$$area2>::hour<time_step>
+  name.remove_prefix(variable_end + SEPARATOR.size());
+  const auto link_end = name.find(SEPARATOR);
+  if (link_end == std::string_view::npos ||
+      !BetweenChevrons(name.substr(0, link_end), result.link) ||
+      result.link.find(AREA_SEPARATOR) == std::string_view::npos) {
+    return result;
+  }
+
+  name.remove_prefix(link_end + SEPARATOR.size());
+  std::string_view time_step;
+  if (!BetweenChevrons(name.substr(0, name.find(SEPARATOR)), time_step)) {
+    return result;
+  }
+  const auto [end, ec] = std::from_chars(
+      time_step.data(), time_step.data() + time_step.size(), result.time_step);
+  if (ec != std::errc()) {
+    return result;
+  }
+  result.type = type;
+  return result;
+}
+
+LinkIndex::LinkIndex(const std::vector<ActiveLink>& links) {
+  for (const auto& link : links) {
+    // spaces are written as '*' in the variable names, an area with a '*' or
+    // the area separator in its name can never be matched
+    if (!IsMatchable(link.linkor()) || !IsMatchable(link.linkex())) {
+      continue;
+    }
+    // the first link wins, as with a linear search
+    links_.try_emplace(Substituted(link.linkor()) + std::string(AREA_SEPARATOR) +
+                           Substituted(link.linkex()),
+                       link.get_idLink());
+  }
+}
+
+bool LinkIndex::find(std::string_view link, linkId& id) const {
+  const auto it = links_.find(link);
+  if (it == links_.end()) {
+    return false;
+  }
+  id = it->second;
+  return true;
+}
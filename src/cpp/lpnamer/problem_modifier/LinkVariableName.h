@@ -0,0 +1,50 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "ActiveLinks.h"
+#include "ColumnToChange.h"
+
+enum class LinkVariableType { NONE, NTC, DIRECT_COST, INDIRECT_COST };
+
+/*!
+ *  \brief fields of an Antares link variable name such as
+ * NTCDirect::link<area1$$area2>::hour<12>. Views into the parsed name.
+ */
+struct LinkVariableName {
+  LinkVariableType type = LinkVariableType::NONE;
+  // area1$$area2, spaces of the areas names being written as '*'
+  std::string_view link;
+  unsigned int time_step = 0;
+};
+
+/*!
+ *  \brief single pass over the name, without allocation. type is NONE for
+ * the variables that are not NTC or link costs, or that are malformed.
+ */
+LinkVariableName ParseLinkVariableName(std::string_view name);
+
+/*!
+ *  \brief finds the active link of the link field of a variable name
+ */
+class LinkIndex {
+ public:
+  explicit LinkIndex(const std::vector<ActiveLink>& links);
+
+  /*!
+   *  \brief true and id of the link when link is one of the active links
+   */
+  bool find(std::string_view link, linkId& id) const;
+
+ private:
+  struct Hash {
+    using is_transparent = void;
+    size_t operator()(std::string_view key) const {
+      return std::hash<std::string_view>{}(key);
+    }
+  };
+  std::unordered_map<std::string, linkId, Hash, std::equal_to<>> links_;
+};
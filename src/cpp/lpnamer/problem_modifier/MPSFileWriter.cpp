@@ -7,9 +7,12 @@
 #include "LinkProblemsGenerator.h"
 
 void MPSFileWriter::Write_problem(Problem *in_prblm) {
-  auto const lp_mps_name = lp_dir_ / in_prblm->_name;
+  auto lp_mps_name = lp_dir_ / in_prblm->_name;
+  // readers find the compressed file from its uncompressed name
+  lp_mps_name += compression_extension(compression_);
   in_prblm->write_prob_mps(lp_mps_name);
 }
 
-MPSFileWriter::MPSFileWriter(std::filesystem::path lp_dir)
-    : lp_dir_(std::move(lp_dir)) {}
+MPSFileWriter::MPSFileWriter(std::filesystem::path lp_dir,
+                             FileCompression compression)
+    : lp_dir_(std::move(lp_dir)), compression_(compression) {}
@@ -2,11 +2,14 @@
 
 #include "IProblemWriter.h"
 #include "LinkProblemsGenerator.h"
+#include "multisolver_interface/ProblemFileCompression.h"
 
 class MPSFileWriter : public IProblemWriter {
   void Write_problem(Problem *in_prblm) override;
 
  public:
-  MPSFileWriter(std::filesystem::path lp_dir);
+  explicit MPSFileWriter(std::filesystem::path lp_dir,
+                         FileCompression compression = FileCompression::NONE);
   std::filesystem::path lp_dir_;
+  FileCompression compression_;
 };
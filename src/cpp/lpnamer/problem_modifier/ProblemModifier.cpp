@@ -15,23 +15,6 @@ std::set<int> extract_time_steps(
   return result;
 }
 
-std::vector<Candidate> ProblemModifier::candidates_with_not_null_profile(
-    const std::vector<ActiveLink> &active_links,
-    const std::set<int> &time_steps) const {
-  std::vector<Candidate> candidates_to_keep;
-
-  for (const auto &link : active_links) {
-    auto const &candidates = link.getCandidates();
-    std::copy_if(candidates.begin(), candidates.end(),
-                 std::back_inserter(candidates_to_keep),
-                 [this, &link, &time_steps](auto candidate) {
-                   return !candidate.hasNullProfile(chronicleToUse(link),
-                                                    time_steps);
-                 });
-  }
-  return candidates_to_keep;
-}
-
 std::vector<int> extract_col_ids(const ColumnsToChange &columns_to_change) {
   std::vector<int> col_ids;
   col_ids.reserve(columns_to_change.size());
@@ -107,14 +90,43 @@ void ProblemModifier::changeProblem(
     }
   }
 
-  add_new_columns(candidates_with_not_null_profile(
-      active_links, extract_time_steps(p_ntc_columns)));
+  ensure_time_steps_are_in_profiles(p_ntc_columns);
+  ensure_time_steps_are_in_profiles(p_direct_cost_columns);
+  ensure_time_steps_are_in_profiles(p_indirect_cost_columns);
+  load_coefficient_tables(active_links);
+  add_new_columns(active_links, extract_time_steps(p_ntc_columns));
 
   add_new_ntc_constraints(active_links, p_ntc_columns);
   add_new_direct_cost_constraints(active_links, p_direct_cost_columns);
   add_new_indirect_cost_constraints(active_links, p_indirect_cost_columns);
 }
 
+void ProblemModifier::ensure_time_steps_are_in_profiles(
+    const std::map<linkId, ColumnsToChange> &p_columns) const {
+  for (const auto &[link_id, columns] : p_columns) {
+    for (const auto &column : columns) {
+      if (column.time_step >= NUMBER_OF_HOUR_PER_YEAR) {
+        auto log_location = LOGLOCATION;
+        auto err_msg =
+            "Link profiles can be requested between point 0 and 8759.";
+        (*logger_)(LogUtils::LOGLEVEL::FATAL) << log_location << err_msg;
+        throw LinkProfile::InvalidHourForProfile(err_msg, log_location);
+      }
+    }
+  }
+}
+
+void ProblemModifier::load_coefficient_tables(
+    const std::vector<ActiveLink> &active_links) {
+  const auto mc_year = _math_problem->McYear();
+  link_tables_.clear();
+  link_tables_.reserve(active_links.size());
+  for (const auto &link : active_links) {
+    link_tables_.push_back(
+        &coefficient_tables_->get(link, link.chronicle(mc_year)));
+  }
+}
+
 void ProblemModifier::add_new_ntc_constraints(
     const std::vector<ActiveLink> &active_links,
     const std::map<linkId, ColumnsToChange> &p_ntc_columns) {
@@ -126,12 +138,16 @@ void ProblemModifier::add_new_ntc_constraints(
 
   rstart.push_back(0);
 
-  for (const auto &link : active_links) {
-    for (const ColumnToChange &column : p_ntc_columns.at(link.get_idLink())) {
-      add_direct_profile_column_constraint(dmatval, colind, rowtype, rhs,
-                                           rstart, link, column);
-      add_indirect_profile_ntc_column_constraint(dmatval, colind, rowtype, rhs,
-                                                 rstart, link, column);
+  for (size_t link_index(0); link_index < active_links.size(); ++link_index) {
+    const auto &table = *link_tables_[link_index];
+    for (const ColumnToChange &column :
+         p_ntc_columns.at(active_links[link_index].get_idLink())) {
+      add_profile_row(dmatval, colind, rowtype, rhs, rstart, link_index,
+                      column, 'L', table.installed_direct(column.time_step),
+                      table.direct(column.time_step), -1);
+      add_profile_row(dmatval, colind, rowtype, rhs, rstart, link_index,
+                      column, 'G', -table.installed_indirect(column.time_step),
+                      table.indirect(column.time_step), 1);
     }
   }
 
@@ -149,13 +165,17 @@ void ProblemModifier::add_new_direct_cost_constraints(
 
   rstart.push_back(0);
 
-  for (const ActiveLink &link : active_links) {
-    if (p_cost_columns.find(link.get_idLink()) != p_cost_columns.end()) {
-      for (const ColumnToChange &column :
-           p_cost_columns.at(link.get_idLink())) {
-        add_direct_profile_column_constraint(dmatval, colind, rowtype, rhs,
-                                             rstart, link, column);
-      }
+  for (size_t link_index(0); link_index < active_links.size(); ++link_index) {
+    const auto columns =
+        p_cost_columns.find(active_links[link_index].get_idLink());
+    if (columns == p_cost_columns.end()) {
+      continue;
+    }
+    const auto &table = *link_tables_[link_index];
+    for (const ColumnToChange &column : columns->second) {
+      add_profile_row(dmatval, colind, rowtype, rhs, rstart, link_index,
+                      column, 'L', table.installed_direct(column.time_step),
+                      table.direct(column.time_step), -1);
     }
   }
 
@@ -173,144 +193,78 @@ void ProblemModifier::add_new_indirect_cost_constraints(
 
   rstart.push_back(0);
 
-  for (const auto &link : active_links) {
-    if (p_cost_columns.find(link.get_idLink()) != p_cost_columns.end()) {
-      for (const ColumnToChange &column :
-           p_cost_columns.at(link.get_idLink())) {
-        add_indirect_cost_column_constraint(dmatval, colind, rowtype, rhs,
-                                            rstart, link, column);
-      }
+  for (size_t link_index(0); link_index < active_links.size(); ++link_index) {
+    const auto columns =
+        p_cost_columns.find(active_links[link_index].get_idLink());
+    if (columns == p_cost_columns.end()) {
+      continue;
+    }
+    const auto &table = *link_tables_[link_index];
+    for (const ColumnToChange &column : columns->second) {
+      add_profile_row(dmatval, colind, rowtype, rhs, rstart, link_index,
+                      column, 'L', table.installed_indirect(column.time_step),
+                      table.indirect(column.time_step), -1);
     }
   }
 
   solver_addrows(*_math_problem, rowtype, rhs, {}, rstart, colind, dmatval);
 }
 
-void ProblemModifier::add_direct_profile_column_constraint(
+void ProblemModifier::add_profile_row(
     std::vector<double> &dmatval, std::vector<int> &colind,
     std::vector<char> &rowtype, std::vector<double> &rhs,
-    std::vector<int> &rstart, const ActiveLink &link,
-    const ColumnToChange &column) {
-  unsigned int chronicle_to_use = chronicleToUse(link);
-
-  double already_installed_capacity(link.get_already_installed_capacity());
-  double direct_already_installed_profile_at_timestep =
-      link.already_installed_direct_profile(chronicle_to_use, column.time_step);
-  rhs.push_back(already_installed_capacity *
-                direct_already_installed_profile_at_timestep);
-
-  rowtype.push_back('L');
+    std::vector<int> &rstart, size_t link_index, const ColumnToChange &column,
+    char row_type, double rhs_value, const double *factors,
+    double sign) const {
+  rhs.push_back(rhs_value);
+  rowtype.push_back(row_type);
   colind.push_back(static_cast<int>(column.id));
   dmatval.push_back(1);
-  for (const auto &candidate : link.getCandidates()) {
-    if (candidateContributionDirectIsNotNull(column, chronicle_to_use,
-                                             candidate)) {
-      colind.push_back(
-          static_cast<int>(_candidate_col_id[candidate.get_name()]));
-      dmatval.push_back(
-          -candidate.directCapacityFactor(chronicle_to_use, column.time_step));
-    }
-  }
-  rstart.push_back(static_cast<int>(dmatval.size()));
-}
-bool ProblemModifier::candidateContributionDirectIsNotNull(
-    const ColumnToChange &column, unsigned int chronicle_to_use,
-    const Candidate &candidate) const {
-  return candidate.directCapacityFactor(chronicle_to_use, column.time_step) !=
-         0.0;
-}
 
-void ProblemModifier::add_indirect_profile_ntc_column_constraint(
-    std::vector<double> &dmatval, std::vector<int> &colind,
-    std::vector<char> &rowtype, std::vector<double> &rhs,
-    std::vector<int> &rstart, const ActiveLink &link,
-    const ColumnToChange &column) {
-  unsigned int chronicle_to_use = chronicleToUse(link);
-
-  double already_installed_capacity(link.get_already_installed_capacity());
-  double indirect_already_installed_profile_at_timestep =
-      link.already_installed_indirect_profile(chronicle_to_use,
-                                              column.time_step);
-  rhs.push_back(-already_installed_capacity *
-                indirect_already_installed_profile_at_timestep);
-
-  rowtype.push_back('G');
-  colind.push_back(static_cast<int>(column.id));
-  dmatval.push_back(1);
-  for (const auto &candidate : link.getCandidates()) {
-    if (candidateContributionIndirectIsNotNull(column, chronicle_to_use,
-                                               candidate)) {
-      colind.push_back(
-          static_cast<int>(_candidate_col_id[candidate.get_name()]));
-      dmatval.push_back(
-          candidate.indirectCapacityFactor(chronicle_to_use, column.time_step));
+  const auto &candidate_columns = link_candidate_columns_[link_index];
+  for (size_t candidate(0); candidate < candidate_columns.size(); ++candidate) {
+    if (factors[candidate] != 0.0 && candidate_columns[candidate] >= 0) {
+      colind.push_back(candidate_columns[candidate]);
+      dmatval.push_back(sign * factors[candidate]);
     }
   }
   rstart.push_back(static_cast<int>(dmatval.size()));
 }
 
-bool ProblemModifier::candidateContributionIndirectIsNotNull(
-    const ColumnToChange &column, unsigned int chronicle_to_use,
-    const Candidate &candidate) const {
-  return candidate.indirectCapacityFactor(chronicle_to_use, column.time_step) !=
-         0.0;
-}
-
-unsigned int ProblemModifier::chronicleToUse(const ActiveLink &link) const {
-  auto chronicle_map = link.McYearToChronicle();
-  auto problem_mc_year = _math_problem->McYear();
-  auto chronicle_to_use = chronicle_map[problem_mc_year];
-  return chronicle_to_use;
-}
-
-void ProblemModifier::add_indirect_cost_column_constraint(
-    std::vector<double> &dmatval, std::vector<int> &colind,
-    std::vector<char> &rowtype, std::vector<double> &rhs,
-    std::vector<int> &rstart, const ActiveLink &link,
-    const ColumnToChange &column) {
-  unsigned int chronicle_to_use = chronicleToUse(link);
-
-  double already_installed_capacity(link.get_already_installed_capacity());
-  double indirect_already_installed_profile_at_timestep =
-      link.already_installed_indirect_profile(chronicle_to_use,
-                                              column.time_step);
-  rhs.push_back(already_installed_capacity *
-                indirect_already_installed_profile_at_timestep);
-
-  rowtype.push_back('L');
-  colind.push_back(static_cast<int>(column.id));
-  dmatval.push_back(1);
-
-  for (const auto &candidate : link.getCandidates()) {
-    if (candidate.indirectCapacityFactor(chronicle_to_use, column.time_step) !=
-        0.0) {
-      colind.push_back(
-          static_cast<int>(_candidate_col_id[candidate.get_name()]));
-      dmatval.push_back(-candidate.indirectCapacityFactor(chronicle_to_use,
-                                                          column.time_step));
+void ProblemModifier::add_new_columns(
+    const std::vector<ActiveLink> &active_links,
+    const std::set<int> &time_steps) {
+  std::vector<std::string> candidates_colnames;
+  link_candidate_columns_.assign(active_links.size(), {});
+  for (size_t link_index(0); link_index < active_links.size(); ++link_index) {
+    const auto &candidates = active_links[link_index].getCandidates();
+    const auto not_null =
+        link_tables_[link_index]->not_null_candidates(time_steps);
+    auto &candidate_columns = link_candidate_columns_[link_index];
+    candidate_columns.assign(candidates.size(), -1);
+    for (size_t candidate(0); candidate < candidates.size(); ++candidate) {
+      if (!not_null[candidate]) {
+        continue;
+      }
+      const auto &name = candidates[candidate].get_name();
+      auto [it, inserted] = _candidate_col_id.try_emplace(
+          name,
+          static_cast<unsigned>(_candidate_col_id.size()) + _n_cols_at_start);
+      if (inserted) {
+        candidates_colnames.push_back(name);
+      }
+      candidate_columns[candidate] = static_cast<int>(it->second);
     }
   }
-  rstart.push_back(static_cast<int>(dmatval.size()));
-}
 
-void ProblemModifier::add_new_columns(
-    const std::vector<Candidate> &candidates) {
-  if (!candidates.empty()) {
-    unsigned int n_candidates = candidates.size();
+  if (!candidates_colnames.empty()) {
+    unsigned int n_candidates = candidates_colnames.size();
     std::vector<double> objectives(n_candidates, 0);
     std::vector<double> lb(n_candidates, -1e20);
     std::vector<double> ub(n_candidates, 1e20);
     std::vector<char> coltypes(n_candidates, 'C');
     std::vector<int> mstart(n_candidates, 0);
-    std::vector<std::string> candidates_colnames;
-
-    for (const auto &candidate : candidates) {
-      candidates_colnames.push_back(candidate.get_name());
-      unsigned int new_index =
-          static_cast<unsigned>(_candidate_col_id.size()) + _n_cols_at_start;
-      _candidate_col_id[candidate.get_name()] = new_index;
-    }
     solver_addcols(*_math_problem, objectives, mstart, {}, {}, lb, ub, coltypes,
                    candidates_colnames);
   }
-}
\ No newline at end of file
+}
@@ -6,19 +6,32 @@
 
 #include <map>
 #include <memory>
+#include <set>
+#include <utility>
 #include <vector>
 
 #include "ActiveLinks.h"
 #include "ColumnToChange.h"
+#include "LinkCoefficientTables.h"
 #include "LogUtils.h"
 #include "Problem.h"
 #include "ProblemGenerationLogger.h"
 
 class ProblemModifier {
  public:
-  ProblemModifier(
+  explicit ProblemModifier(
       ProblemGenerationLog::ProblemGenerationLoggerSharedPointer logger)
-      : logger_(logger) {}
+      : ProblemModifier(std::move(logger),
+                        std::make_shared<LinkCoefficientTables>()) {}
+  /*!
+   *  \brief coefficient_tables are shared by the modifiers of every problem
+   * so that the coefficients of a (link, chronicle) are computed only once
+   */
+  ProblemModifier(
+      ProblemGenerationLog::ProblemGenerationLoggerSharedPointer logger,
+      std::shared_ptr<LinkCoefficientTables> coefficient_tables)
+      : logger_(std::move(logger)),
+        coefficient_tables_(std::move(coefficient_tables)) {}
 
   void changeProblem(
       Problem *problem, const std::vector<ActiveLink> &active_links,
@@ -46,7 +59,13 @@ class ProblemModifier {
 
   void change_lower_bounds_to_neg_inf(const std::vector<int> &col_id) const;
 
-  void add_new_columns(const std::vector<Candidate> &candidates);
+  void ensure_time_steps_are_in_profiles(
+      const std::map<linkId, ColumnsToChange> &p_columns) const;
+
+  void load_coefficient_tables(const std::vector<ActiveLink> &active_links);
+
+  void add_new_columns(const std::vector<ActiveLink> &active_links,
+                       const std::set<int> &time_steps);
 
   void add_new_ntc_constraints(
       const std::vector<ActiveLink> &active_links,
@@ -60,44 +79,27 @@ class ProblemModifier {
       const std::vector<ActiveLink> &active_links,
       const std::map<linkId, ColumnsToChange> &p_cost_columns);
 
+  /*!
+   *  \brief appends the row column - sign * sum(factor * candidate) against
+   * rhs_value, for the candidates with a not null factor
+   */
+  void add_profile_row(std::vector<double> &dmatval, std::vector<int> &colind,
+                       std::vector<char> &rowtype, std::vector<double> &rhs,
+                       std::vector<int> &rstart, size_t link_index,
+                       const ColumnToChange &column, char row_type,
+                       double rhs_value, const double *factors,
+                       double sign) const;
+
   Problem *_math_problem;
   std::map<std::string, unsigned int> _candidate_col_id;
   unsigned int _n_cols_at_start = 0;
+  // per active link, its coefficient table for the mc year of the problem and
+  // the column of each of its candidates (-1 when it is not in the problem)
+  std::vector<const LinkCoefficientTable *> link_tables_;
+  std::vector<std::vector<int>> link_candidate_columns_;
 
-  void add_direct_profile_column_constraint(std::vector<double> &dmatval,
-                                            std::vector<int> &colind,
-                                            std::vector<char> &rowtype,
-                                            std::vector<double> &rhs,
-                                            std::vector<int> &rstart,
-                                            const ActiveLink &link,
-                                            const ColumnToChange &column);
-
-  void add_indirect_profile_ntc_column_constraint(std::vector<double> &dmatval,
-                                                  std::vector<int> &colind,
-                                                  std::vector<char> &rowtype,
-                                                  std::vector<double> &rhs,
-                                                  std::vector<int> &rstart,
-                                                  const ActiveLink &link,
-                                                  const ColumnToChange &column);
-  void add_indirect_cost_column_constraint(std::vector<double> &dmatval,
-                                           std::vector<int> &colind,
-                                           std::vector<char> &rowtype,
-                                           std::vector<double> &rhs,
-                                           std::vector<int> &rstart,
-                                           const ActiveLink &link,
-                                           const ColumnToChange &column);
-  bool candidateContributionDirectIsNotNull(const ColumnToChange &column,
-                                            unsigned int chronicle_to_use,
-                                            const Candidate &candidate) const;
-  unsigned int chronicleToUse(const ActiveLink &link) const;
-  std::vector<Candidate> candidates_with_not_null_profile(
-      const std::vector<ActiveLink> &active_links,
-      const std::set<int> &time_steps) const;
-
-  bool candidateContributionIndirectIsNotNull(const ColumnToChange &column,
-                                              unsigned int chronicle_to_use,
-                                              const Candidate &candidate) const;
   ProblemGenerationLog::ProblemGenerationLoggerSharedPointer logger_;
+  std::shared_ptr<LinkCoefficientTables> coefficient_tables_;
 };
 
 #endif  // ANTARESXPANSION_PROBLEMMODIFIER_H
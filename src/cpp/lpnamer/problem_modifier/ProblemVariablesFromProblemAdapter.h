@@ -2,12 +2,13 @@
 
 #include "IProblemVariablesProviderPort.h"
 #include "LinkProblemsGenerator.h"
+#include "LinkVariableName.h"
 
 class ProblemVariablesFromProblemAdapter
     : public IProblemVariablesProviderPort {
  public:
   ProblemVariablesFromProblemAdapter(
-      std::shared_ptr<Problem> problem, std::vector<class ActiveLink> vector_1,
+      std::shared_ptr<Problem> problem, const std::vector<ActiveLink>& links,
       std::shared_ptr<ProblemGenerationLog::ProblemGenerationLogger>
           shared_ptr_1);
   ProblemVariables Provide() override;
@@ -19,6 +20,6 @@ class ProblemVariablesFromProblemAdapter
       std::map<colId, ColumnsToChange>& p_indirect_cost_columns) const;
 
   std::shared_ptr<Problem> problem_;
-  const std::vector<class ActiveLink> active_links_;
+  const LinkIndex link_index_;
   std::shared_ptr<ProblemGenerationLog::ProblemGenerationLogger> logger_;
 };
@@ -4,15 +4,18 @@
 
 #include "XpansionProblemsFromAntaresProvider.h"
 
+#include <execution>
 #include <utility>
 
 #include "../model/Problem.h"
-#include "AntaresProblemToXpansionProblemTranslator.h"
 
 XpansionProblemsFromAntaresProvider::XpansionProblemsFromAntaresProvider(
     const Antares::Solver::LpsFromAntares& lps)
-    : antares_hebdo_problems(lps) {
-  std::cout << "Provider by copy \n";
+    : antares_hebdo_problems(lps), constant_view_(lps.constantProblemData) {
+  problem_ids_.reserve(lps.weeklyProblems.size());
+  for (const auto& [problem_id, hebdo_data] : lps.weeklyProblems) {
+    problem_ids_.push_back(problem_id);
+  }
 }
 
 std::vector<std::shared_ptr<Problem>>
@@ -20,15 +23,33 @@ XpansionProblemsFromAntaresProvider::provideProblems(
     const std::string& solver_name,
     SolverLogManager& solver_log_manager) const
 {
-  std::vector<std::shared_ptr<Problem>> xpansion_problems;
-  xpansion_problems.reserve(
-      antares_hebdo_problems.weekCount());
-  for (const auto& [problem_id, hebdo_data] :
-       antares_hebdo_problems.weeklyProblems) {
-    xpansion_problems.push_back(
-        AntaresProblemToXpansionProblemTranslator::translateToXpansionProblem(
-            antares_hebdo_problems,
-            problem_id.year, problem_id.week, solver_name, solver_log_manager));
-  }
+  std::vector<std::shared_ptr<Problem>> xpansion_problems(problem_ids_.size());
+  std::transform(std::execution::par, problem_ids_.begin(), problem_ids_.end(),
+                 xpansion_problems.begin(),
+                 [this, &solver_name,
+                  &solver_log_manager](const auto& problem_id) {
+                   return AntaresProblemToXpansionProblemTranslator::
+                       translateToXpansionProblem(
+                           constant_view_,
+                           antares_hebdo_problems.weeklyProblems.at(problem_id),
+                           solver_name, solver_log_manager);
+                 });
   return xpansion_problems;
 }
+
+size_t XpansionProblemsFromAntaresProvider::problemCount() const {
+  return problem_ids_.size();
+}
+
+std::shared_ptr<Problem> XpansionProblemsFromAntaresProvider::provideProblem(
+    size_t index, const std::string& solver_name,
+    SolverLogManager& solver_log_manager) const {
+  return AntaresProblemToXpansionProblemTranslator::translateToXpansionProblem(
+      constant_view_, antares_hebdo_problems.weeklyProblems.at(problemId(index)),
+      solver_name, solver_log_manager);
+}
+
+const Antares::Solver::WeeklyProblemId&
+XpansionProblemsFromAntaresProvider::problemId(size_t index) const {
+  return problem_ids_.at(index);
+}
@@ -7,6 +7,7 @@
 #include <antares/solver/lps/LpsFromAntares.h>
 
 #include "../model/Problem.h"
+#include "AntaresProblemToXpansionProblemTranslator.h"
 #include "IXpansionProblemsProvider.h"
 
 class XpansionProblemsFromAntaresProvider : public IXpansionProblemsProvider {
@@ -15,5 +16,17 @@ class XpansionProblemsFromAntaresProvider : public IXpansionProblemsProvider {
   [[nodiscard]] std::vector<std::shared_ptr<Problem>> provideProblems(
       const std::string& solver_name,
       SolverLogManager& solver_log_manager) const override;
+  [[nodiscard]] size_t problemCount() const override;
+  [[nodiscard]] std::shared_ptr<Problem> provideProblem(
+      size_t index, const std::string& solver_name,
+      SolverLogManager& solver_log_manager) const override;
+  [[nodiscard]] const Antares::Solver::WeeklyProblemId& problemId(
+      size_t index) const;
   const Antares::Solver::LpsFromAntares& antares_hebdo_problems;
+
+ private:
+  // the study data is only referenced, never copied
+  const AntaresConstantProblemView constant_view_;
+  // in the order of the weekly problems map
+  std::vector<Antares::Solver::WeeklyProblemId> problem_ids_;
 };
@@ -27,6 +27,18 @@ ZipProblemsProviderAdapter::provideProblems(
                  });
   return problems;
 }
+size_t ZipProblemsProviderAdapter::problemCount() const {
+  return problem_names_.size();
+}
+
+std::shared_ptr<Problem> ZipProblemsProviderAdapter::provideProblem(
+    size_t index, const std::string& solver_name,
+    SolverLogManager& solver_log_manager) const {
+  ZipProblemProviderAdapter problem_provider(lp_dir_, problem_names_.at(index),
+                                             archive_reader_);
+  return problem_provider.provide_problem(solver_name, solver_log_manager);
+}
+
 ZipProblemsProviderAdapter::ZipProblemsProviderAdapter(
     std::filesystem::path lp_dir, std::shared_ptr<ArchiveReader> archive_reader,
     std::vector<std::string> problem_names)
@@ -14,6 +14,10 @@ class ZipProblemsProviderAdapter : public IXpansionProblemsProvider {
   [[nodiscard]] std::vector<std::shared_ptr<Problem>> provideProblems(
       const std::string& solver_name,
       SolverLogManager& solver_log_manager) const override;
+  [[nodiscard]] size_t problemCount() const override;
+  [[nodiscard]] std::shared_ptr<Problem> provideProblem(
+      size_t index, const std::string& solver_name,
+      SolverLogManager& solver_log_manager) const override;
   std::shared_ptr<ArchiveReader> archive_reader_;
   std::filesystem::path lp_dir_;
   std::vector<std::string> problem_names_;
@@ -2,6 +2,7 @@
 #include "COIN_common_functions.h"
 
 #include <sstream>
+#include <type_traits>
 
 #include "CoinFinite.hpp"
 #include "LogUtils.h"
@@ -31,6 +32,40 @@ void fill_rows_from_COIN_matrix(const CoinPackedMatrix &matrix, int *mstart,
   *nels = nelemsToReturn;
 }
 
+SparseMatrixView view_of_COIN_matrix(const CoinPackedMatrix &matrix) {
+  static_assert(std::is_same_v<CoinBigIndex, int>,
+                "the starts of a COIN matrix are viewed as int");
+  const int major_dimension = matrix.getMajorDim();
+  const CoinBigIndex *starts = matrix.getVectorStarts();
+  if (major_dimension == 0 || starts == nullptr) {
+    return {ArrayView<int>(std::vector<int>(1, 0)), ArrayView<int>(),
+            ArrayView<double>()};
+  }
+  if (!matrix.hasGaps()) {
+    const auto nelems = static_cast<size_t>(starts[major_dimension]);
+    return {ArrayView<int>(std::span(starts, major_dimension + 1)),
+            ArrayView<int>(std::span(matrix.getIndices(), nelems)),
+            ArrayView<double>(std::span(matrix.getElements(), nelems))};
+  }
+
+  const int *lengths = matrix.getVectorLengths();
+  std::vector<int> packed_starts(major_dimension + 1, 0);
+  std::vector<int> indexes;
+  std::vector<double> values;
+  indexes.reserve(matrix.getNumElements());
+  values.reserve(matrix.getNumElements());
+  for (int major(0); major < major_dimension; ++major) {
+    indexes.insert(indexes.end(), matrix.getIndices() + starts[major],
+                   matrix.getIndices() + starts[major] + lengths[major]);
+    values.insert(values.end(), matrix.getElements() + starts[major],
+                  matrix.getElements() + starts[major] + lengths[major]);
+    packed_starts[major + 1] = static_cast<int>(indexes.size());
+  }
+  return {ArrayView<int>(std::move(packed_starts)),
+          ArrayView<int>(std::move(indexes)),
+          ArrayView<double>(std::move(values))};
+}
+
 void fill_row_type_from_row_bounds(const double *rowLower,
                                    const double *rowUpper, char *qrtype,
                                    int first, int last) {
@@ -3,12 +3,19 @@
 #include <vector>
 
 #include "CoinPackedMatrix.hpp"
+#include "multisolver_interface/SparseMatrixView.h"
 namespace coin_common {
 
 void fill_rows_from_COIN_matrix(const CoinPackedMatrix &matrix, int *mstart,
                                 int *mclind, double *dmatval, int *nels,
                                 int first, int last);
 
+/**
+ * @brief view on the arrays of the matrix, or on a packed copy when the matrix
+ * has gaps between its vectors
+ */
+SparseMatrixView view_of_COIN_matrix(const CoinPackedMatrix &matrix);
+
 void fill_row_type_from_row_bounds(const double *rowLower,
                                    const double *rowUpper, char *qrtype,
                                    int first, int last);
@@ -0,0 +1,281 @@
+#include "MpsWriter.h"
+
+#include <charconv>
+#include <cstring>
+#include <system_error>
+
+#include "LogUtils.h"
+#include "multisolver_interface/SolverAbstract.h"
+
+namespace {
+/* longest shortest round-trip representation of a double is 24 chars */
+constexpr std::size_t MAX_DOUBLE_CHARS = 32;
+
+bool is_free_row(double lower, double upper, double infinity) {
+  return lower <= -infinity && upper >= infinity;
+}
+}  // namespace
+
+MpsWriter::MpsWriter(std::size_t buffer_size) : buffer_(buffer_size) {}
+
+std::size_t MpsWriter::write(const MpsProblemView &problem,
+                             const std::filesystem::path &filename) {
+  open(filename);
+
+  append("NAME ");
+  append(problem.problem_name.empty() ? "BLANK" : problem.problem_name);
+  append(" FREE\n");
+  write_rows(problem);
+  write_columns(problem);
+  write_rhs(problem);
+  write_ranges(problem);
+  write_bounds(problem);
+  append("ENDATA\n");
+
+  close();
+  return written_;
+}
+
+void MpsWriter::open(const std::filesystem::path &filename) {
+  used_ = 0;
+  written_ = 0;
+  file_.open(filename, compression_from_extension(filename));
+}
+
+void MpsWriter::close() {
+  flush();
+  file_.close();
+}
+
+void MpsWriter::flush() {
+  if (used_ == 0) {
+    return;
+  }
+  file_.write(buffer_.data(), used_);
+  written_ += used_;
+  used_ = 0;
+}
+
+void MpsWriter::reserve(std::size_t size) {
+  if (used_ + size > buffer_.size()) {
+    flush();
+  }
+}
+
+void MpsWriter::append(std::string_view text) {
+  if (text.size() > buffer_.size()) {
+    flush();
+    file_.write(text.data(), text.size());
+    written_ += text.size();
+    return;
+  }
+  reserve(text.size());
+  std::memcpy(buffer_.data() + used_, text.data(), text.size());
+  used_ += text.size();
+}
+
+void MpsWriter::append(double value) {
+  reserve(MAX_DOUBLE_CHARS);
+  auto *begin = buffer_.data() + used_;
+  const auto [end, ec] =
+      std::to_chars(begin, buffer_.data() + buffer_.size(), value);
+  if (ec != std::errc()) {
+    throw GenericSolverException(LOGLOCATION +
+                                 "ERROR : could not format a number of the "
+                                 "MPS file");
+  }
+  used_ += end - begin;
+}
+
+void MpsWriter::append_generated_name(char prefix, int index) {
+  reserve(MAX_DOUBLE_CHARS);
+  buffer_[used_++] = prefix;
+  auto *begin = buffer_.data() + used_;
+  const auto [end, ec] =
+      std::to_chars(begin, buffer_.data() + buffer_.size(), index);
+  if (ec != std::errc()) {
+    throw GenericSolverException(LOGLOCATION +
+                                 "ERROR : could not format a number of the "
+                                 "MPS file");
+  }
+  used_ += end - begin;
+}
+
+void MpsWriter::append_col_name(const MpsProblemView &problem, int col) {
+  // If the user added columns but did not add names to them, names may be
+  // missing or empty
+  if (problem.col_names &&
+      static_cast<std::size_t>(col) < problem.col_names->size() &&
+      !(*problem.col_names)[col].empty()) {
+    append((*problem.col_names)[col]);
+  } else {
+    append_generated_name('C', col);
+  }
+}
+
+void MpsWriter::append_row_name(const MpsProblemView &problem, int row) {
+  if (problem.row_names &&
+      static_cast<std::size_t>(row) < problem.row_names->size() &&
+      !(*problem.row_names)[row].empty()) {
+    append((*problem.row_names)[row]);
+  } else {
+    append_generated_name('R', row);
+  }
+}
+
+void MpsWriter::write_rows(const MpsProblemView &problem) {
+  append("ROWS\n N  ");
+  append(OBJECTIVE_NAME);
+  append("\n");
+  for (int row(0); row < problem.nrows; ++row) {
+    const double lower = problem.row_lower[row];
+    const double upper = problem.row_upper[row];
+    if (lower == upper) {
+      append(" E  ");
+    } else if (lower > -problem.infinity) {
+      // ranged rows are written as G rows with a range
+      append(" G  ");
+    } else if (upper < problem.infinity) {
+      append(" L  ");
+    } else {
+      append(" N  ");
+    }
+    append_row_name(problem, row);
+    append("\n");
+  }
+}
+
+void MpsWriter::write_columns(const MpsProblemView &problem) {
+  append("COLUMNS\n");
+  bool in_integer_block = false;
+  for (int col(0); col < problem.ncols; ++col) {
+    const bool is_integer = problem.integrality && problem.integrality[col];
+    if (is_integer != in_integer_block) {
+      append(is_integer ? "    MARKER  'MARKER'  'INTORG'\n"
+                        : "    MARKER  'MARKER'  'INTEND'\n");
+      in_integer_block = is_integer;
+    }
+
+    const int start = problem.col_starts[col];
+    const int end = start + (problem.col_lengths
+                                 ? problem.col_lengths[col]
+                                 : problem.col_starts[col + 1] - start);
+    // a column must appear at least once to be read back
+    if (problem.obj[col] != 0 || start == end) {
+      append("    ");
+      append_col_name(problem, col);
+      append("  ");
+      append(OBJECTIVE_NAME);
+      append("  ");
+      append(problem.obj[col]);
+      append("\n");
+    }
+    for (int k(start); k < end; ++k) {
+      append("    ");
+      append_col_name(problem, col);
+      append("  ");
+      append_row_name(problem, problem.row_indices[k]);
+      append("  ");
+      append(problem.elements[k]);
+      append("\n");
+    }
+  }
+  if (in_integer_block) {
+    append("    MARKER  'MARKER'  'INTEND'\n");
+  }
+}
+
+void MpsWriter::write_rhs(const MpsProblemView &problem) {
+  append("RHS\n");
+  if (problem.obj_offset != 0) {
+    append("    RHS  ");
+    append(OBJECTIVE_NAME);
+    append("  ");
+    append(problem.obj_offset);
+    append("\n");
+  }
+  for (int row(0); row < problem.nrows; ++row) {
+    const double lower = problem.row_lower[row];
+    const double upper = problem.row_upper[row];
+    if (is_free_row(lower, upper, problem.infinity)) {
+      continue;
+    }
+    const double rhs = lower > -problem.infinity ? lower : upper;
+    if (rhs != 0) {
+      append("    RHS  ");
+      append_row_name(problem, row);
+      append("  ");
+      append(rhs);
+      append("\n");
+    }
+  }
+}
+
+void MpsWriter::write_ranges(const MpsProblemView &problem) {
+  bool has_ranges = false;
+  for (int row(0); row < problem.nrows; ++row) {
+    const double lower = problem.row_lower[row];
+    const double upper = problem.row_upper[row];
+    if (lower != upper && lower > -problem.infinity &&
+        upper < problem.infinity) {
+      if (!has_ranges) {
+        append("RANGES\n");
+        has_ranges = true;
+      }
+      append("    RNG  ");
+      append_row_name(problem, row);
+      append("  ");
+      append(upper - lower);
+      append("\n");
+    }
+  }
+}
+
+void MpsWriter::write_bounds(const MpsProblemView &problem) {
+  append("BOUNDS\n");
+  for (int col(0); col < problem.ncols; ++col) {
+    const double lower = problem.col_lower[col];
+    const double upper = problem.col_upper[col];
+    const bool is_integer = problem.integrality && problem.integrality[col];
+    const bool has_lower = lower > -problem.infinity;
+    const bool has_upper = upper < problem.infinity;
+
+    if (lower == upper) {
+      write_bound(problem, "FX", col, lower);
+    } else if (!has_lower && !has_upper) {
+      write_bound(problem, "FR", col);
+    } else {
+      if (!has_lower) {
+        write_bound(problem, "MI", col);
+      } else if (lower != 0) {
+        write_bound(problem, "LO", col, lower);
+      }
+      if (has_upper) {
+        write_bound(problem, "UP", col, upper);
+      } else if (is_integer) {
+        // some readers make unbounded integer columns binary
+        write_bound(problem, "PL", col);
+      }
+    }
+  }
+}
+
+void MpsWriter::write_bound(const MpsProblemView &problem,
+                            std::string_view type, int col) {
+  append(" ");
+  append(type);
+  append(" BND  ");
+  append_col_name(problem, col);
+  append("\n");
+}
+
+void MpsWriter::write_bound(const MpsProblemView &problem,
+                            std::string_view type, int col, double value) {
+  append(" ");
+  append(type);
+  append(" BND  ");
+  append_col_name(problem, col);
+  append("  ");
+  append(value);
+  append("\n");
+}
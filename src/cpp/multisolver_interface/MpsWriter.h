@@ -0,0 +1,88 @@
+#pragma once
+
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "multisolver_interface/ProblemFileCompression.h"
+
+/**
+ * @brief Read-only, column ordered view of a problem as needed to write it in
+ * MPS format. Nothing is owned: every pointer must outlive the write call.
+ */
+struct MpsProblemView {
+  std::string problem_name;
+  int ncols = 0;
+  int nrows = 0;
+  /* column ordered matrix, lengths may be smaller than start differences */
+  const int *col_starts = nullptr;
+  const int *col_lengths = nullptr;
+  const int *row_indices = nullptr;
+  const double *elements = nullptr;
+
+  const double *obj = nullptr;
+  const double *col_lower = nullptr;
+  const double *col_upper = nullptr;
+  const double *row_lower = nullptr;
+  const double *row_upper = nullptr;
+  /* non zero for integer columns, may be nullptr if problem has no integer */
+  const char *integrality = nullptr;
+
+  /* may be shorter than ncols/nrows, missing names are generated */
+  const std::vector<std::string> *col_names = nullptr;
+  const std::vector<std::string> *row_names = nullptr;
+
+  double infinity = 1e30;
+  double obj_offset = 0.0;
+};
+
+/*!
+ * \class class MpsWriter
+ * \brief Writes free MPS files through a large output buffer, formatting
+ * doubles with their shortest round-trip representation (std::to_chars).
+ * Files ending with .gz or .zst are compressed on the fly.
+ */
+class MpsWriter {
+ public:
+  static constexpr std::size_t DEFAULT_BUFFER_SIZE = 1 << 22;
+  static constexpr std::string_view OBJECTIVE_NAME = "OBJROW";
+
+  explicit MpsWriter(std::size_t buffer_size = DEFAULT_BUFFER_SIZE);
+  MpsWriter(const MpsWriter &) = delete;
+  MpsWriter &operator=(const MpsWriter &) = delete;
+
+  /**
+   * @brief writes the problem in filename
+   *
+   * @return number of bytes written, before compression
+   */
+  std::size_t write(const MpsProblemView &problem,
+                    const std::filesystem::path &filename);
+
+ private:
+  void open(const std::filesystem::path &filename);
+  void close();
+  void flush();
+  void reserve(std::size_t size);
+  void append(std::string_view text);
+  void append(double value);
+  void append_col_name(const MpsProblemView &problem, int col);
+  void append_row_name(const MpsProblemView &problem, int row);
+  void append_generated_name(char prefix, int index);
+
+  void write_rows(const MpsProblemView &problem);
+  void write_columns(const MpsProblemView &problem);
+  void write_rhs(const MpsProblemView &problem);
+  void write_ranges(const MpsProblemView &problem);
+  void write_bounds(const MpsProblemView &problem);
+  void write_bound(const MpsProblemView &problem, std::string_view type,
+                   int col);
+  void write_bound(const MpsProblemView &problem, std::string_view type,
+                   int col, double value);
+
+  std::vector<char> buffer_;
+  std::size_t used_ = 0;
+  std::size_t written_ = 0;
+  CompressedOutputFile file_;
+};
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/*!
+ * \class NameIndex
+ * \brief name -> index map of the rows or columns of a problem, for the
+ * solvers without a native lookup. Built lazily by the first lookup. Additions,
+ * renames and deletions of the last elements are followed; the other changes
+ * rebuild it at the next lookup. With duplicate names the lowest index is
+ * found, as a linear search would, and every change rebuilds it.
+ */
+class NameIndex {
+ public:
+  [[nodiscard]] bool built() const { return built_; }
+
+  void build(const std::vector<std::string> &names) {
+    indexes_.clear();
+    indexes_.reserve(names.size());
+    size_ = static_cast<int>(names.size());
+    has_duplicates_ = false;
+    for (int index(0); index < static_cast<int>(names.size()); ++index) {
+      has_duplicates_ |= !indexes_.try_emplace(names[index], index).second;
+    }
+    built_ = true;
+  }
+
+  /*!
+   * \brief index of name, -1 when there is none. The index must be built.
+   */
+  [[nodiscard]] int find(const std::string &name) const {
+    const auto it = indexes_.find(name);
+    return it == indexes_.end() ? -1 : it->second;
+  }
+
+  /*!
+   * \brief the problem changed in a way that is not followed: rebuilt by the
+   * next lookup
+   */
+  void clear() {
+    indexes_ = {};
+    size_ = 0;
+    has_duplicates_ = false;
+    built_ = false;
+  }
+
+  /*!
+   * \brief names of the elements added from index first
+   */
+  void append(int first, const std::vector<std::string> &names) {
+    if (!built_) {
+      return;
+    }
+    for (int offset(0); offset < static_cast<int>(names.size()); ++offset) {
+      has_duplicates_ |=
+          !indexes_.try_emplace(names[offset], first + offset).second;
+    }
+    size_ = first + static_cast<int>(names.size());
+  }
+
+  void rename(int index, const std::string &old_name,
+              const std::string &new_name) {
+    if (!built_ || old_name == new_name) {
+      return;
+    }
+    // another element may carry either name
+    if (has_duplicates_ || !indexes_.try_emplace(new_name, index).second) {
+      clear();
+      return;
+    }
+    indexes_.erase(old_name);
+  }
+
+  /*!
+   * \brief elements first to last, named deleted_names, are deleted. Only
+   * the deletion of the last elements (cuts for instance) is followed:
+   * otherwise the next elements are shifted, and the solvers generate the
+   * names of unnamed elements from their index, so they are renamed too.
+   */
+  void erase(int first, int last,
+             const std::vector<std::string> &deleted_names) {
+    if (!built_) {
+      return;
+    }
+    if (has_duplicates_ || last != size_ - 1) {
+      clear();
+      return;
+    }
+    for (const auto &name : deleted_names) {
+      indexes_.erase(name);
+    }
+    size_ = first;
+  }
+
+ private:
+  bool built_ = false;
+  // number of elements of the problem
+  int size_ = 0;
+  bool has_duplicates_ = false;
+  std::unordered_map<std::string, int> indexes_;
+};
@@ -0,0 +1,451 @@
+#include "multisolver_interface/ProblemFileCompression.h"
+
+#include <zlib.h>
+#include <zstd.h>
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <fstream>
+#include <functional>
+#include <random>
+#include <sstream>
+#include <vector>
+
+#include "LogUtils.h"
+#include "multisolver_interface/SolverAbstract.h"
+
+#ifdef __linux__
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace {
+constexpr std::size_t CHUNK_SIZE = 1 << 18;
+/* 15 bits window, +16 writes a gzip header, +32 detects zlib or gzip header */
+constexpr int GZIP_WINDOW_BITS = 15 + 16;
+constexpr int AUTO_WINDOW_BITS = 15 + 32;
+
+constexpr std::array<unsigned char, 2> GZIP_MAGIC = {0x1f, 0x8b};
+constexpr std::array<unsigned char, 4> ZSTD_MAGIC = {0x28, 0xb5, 0x2f, 0xfd};
+
+std::string lower_case(std::string text) {
+  for (auto &c : text) {
+    c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+  }
+  return text;
+}
+}  // namespace
+
+FileCompression compression_from_extension(
+    const std::filesystem::path &filename) {
+  const auto extension = lower_case(filename.extension().string());
+  if (extension == ".gz") {
+    return FileCompression::GZIP;
+  }
+  if (extension == ".zst") {
+    return FileCompression::ZSTD;
+  }
+  return FileCompression::NONE;
+}
+
+FileCompression compression_from_name(const std::string &name) {
+  const auto lower_name = lower_case(name);
+  if (lower_name.empty() || lower_name == "none") {
+    return FileCompression::NONE;
+  }
+  if (lower_name == "gzip" || lower_name == "gz") {
+    return FileCompression::GZIP;
+  }
+  if (lower_name == "zstd" || lower_name == "zst") {
+    return FileCompression::ZSTD;
+  }
+  throw InvalidSolverOptionException("compression " + name, LOGLOCATION);
+}
+
+std::string compression_extension(FileCompression compression) {
+  switch (compression) {
+    case FileCompression::GZIP:
+      return ".gz";
+    case FileCompression::ZSTD:
+      return ".zst";
+    default:
+      return "";
+  }
+}
+
+FileCompression detect_compression(const std::filesystem::path &filename) {
+  std::ifstream file(filename, std::ios::binary);
+  std::array<unsigned char, 4> magic = {0, 0, 0, 0};
+  file.read(reinterpret_cast<char *>(magic.data()), magic.size());
+  const auto read = file.gcount();
+  if (read >= 2 && magic[0] == GZIP_MAGIC[0] && magic[1] == GZIP_MAGIC[1]) {
+    return FileCompression::GZIP;
+  }
+  if (read >= 4 && std::equal(ZSTD_MAGIC.begin(), ZSTD_MAGIC.end(),
+                              magic.begin())) {
+    return FileCompression::ZSTD;
+  }
+  return FileCompression::NONE;
+}
+
+std::filesystem::path find_problem_file(
+    const std::filesystem::path &filename) {
+  if (std::filesystem::exists(filename)) {
+    return filename;
+  }
+  std::vector<std::filesystem::path> candidates;
+  for (const auto &extension : {".gz", ".zst"}) {
+    candidates.emplace_back(filename.string() + extension);
+  }
+  // COIN readers append the .mps extension themselves when it is missing
+  if (!filename.has_extension()) {
+    for (const auto &extension : {".mps", ".mps.gz", ".mps.zst"}) {
+      candidates.emplace_back(filename.string() + extension);
+    }
+  }
+  for (const auto &candidate : candidates) {
+    if (std::filesystem::exists(candidate)) {
+      return candidate;
+    }
+  }
+  return filename;
+}
+
+/*************************************************************************************************
+-----------------------------------    Compressed output
+----------------------------------------
+*************************************************************************************************/
+class CompressedOutputFile::Encoder {
+ public:
+  virtual ~Encoder() = default;
+  /* compresses data and passes compressed chunks to sink, finishes the
+   * stream when data is empty and finish is true */
+  virtual void encode(const char *data, std::size_t size, bool finish,
+                      std::FILE *sink) = 0;
+
+ protected:
+  static void write_chunk(const unsigned char *data, std::size_t size,
+                          std::FILE *sink) {
+    if (size > 0 && std::fwrite(data, 1, size, sink) != size) {
+      throw GenericSolverException(LOGLOCATION +
+                                   "ERROR : could not write compressed data");
+    }
+  }
+  std::vector<unsigned char> chunk_ = std::vector<unsigned char>(CHUNK_SIZE);
+};
+
+namespace {
+class GzipEncoder : public CompressedOutputFile::Encoder {
+ public:
+  GzipEncoder() {
+    if (deflateInit2(&stream_, Z_DEFAULT_COMPRESSION, Z_DEFLATED,
+                     GZIP_WINDOW_BITS, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+      throw GenericSolverException(LOGLOCATION +
+                                   "ERROR : could not initialize gzip");
+    }
+  }
+  ~GzipEncoder() override { deflateEnd(&stream_); }
+
+  void encode(const char *data, std::size_t size, bool finish,
+              std::FILE *sink) override {
+    stream_.next_in =
+        reinterpret_cast<Bytef *>(const_cast<char *>(data));
+    stream_.avail_in = static_cast<uInt>(size);
+    const int flush = finish ? Z_FINISH : Z_NO_FLUSH;
+    int status = Z_OK;
+    do {
+      stream_.next_out = chunk_.data();
+      stream_.avail_out = static_cast<uInt>(chunk_.size());
+      status = deflate(&stream_, flush);
+      if (status == Z_STREAM_ERROR) {
+        throw GenericSolverException(LOGLOCATION +
+                                     "ERROR : gzip compression failed");
+      }
+      write_chunk(chunk_.data(), chunk_.size() - stream_.avail_out, sink);
+    } while (stream_.avail_out == 0 || (finish && status != Z_STREAM_END));
+  }
+
+ private:
+  z_stream stream_{};
+};
+
+class ZstdEncoder : public CompressedOutputFile::Encoder {
+ public:
+  ZstdEncoder() : context_(ZSTD_createCCtx()) {
+    if (context_ == nullptr) {
+      throw GenericSolverException(LOGLOCATION +
+                                   "ERROR : could not initialize zstd");
+    }
+  }
+  ~ZstdEncoder() override { ZSTD_freeCCtx(context_); }
+
+  void encode(const char *data, std::size_t size, bool finish,
+              std::FILE *sink) override {
+    ZSTD_inBuffer input = {data, size, 0};
+    const auto mode = finish ? ZSTD_e_end : ZSTD_e_continue;
+    std::size_t remaining = 0;
+    do {
+      ZSTD_outBuffer output = {chunk_.data(), chunk_.size(), 0};
+      remaining = ZSTD_compressStream2(context_, &output, &input, mode);
+      if (ZSTD_isError(remaining)) {
+        throw GenericSolverException(
+            LOGLOCATION + "ERROR : zstd compression failed : " +
+            ZSTD_getErrorName(remaining));
+      }
+      write_chunk(chunk_.data(), output.pos, sink);
+    } while (finish ? remaining != 0 : input.pos < input.size);
+  }
+
+ private:
+  ZSTD_CCtx *context_;
+};
+}  // namespace
+
+CompressedOutputFile::CompressedOutputFile() = default;
+
+CompressedOutputFile::~CompressedOutputFile() {
+  if (file_) {
+    std::fclose(file_);
+  }
+}
+
+void CompressedOutputFile::open(const std::filesystem::path &filename,
+                                FileCompression compression) {
+  filename_ = filename;
+  file_ = std::fopen(filename.string().c_str(), "wb");
+  if (file_ == nullptr) {
+    throw GenericSolverException(LOGLOCATION + "ERROR : could not open " +
+                                 filename.string() + " to write problem.");
+  }
+  // callers already write large chunks
+  std::setvbuf(file_, nullptr, _IONBF, 0);
+  switch (compression) {
+    case FileCompression::GZIP:
+      encoder_ = std::make_unique<GzipEncoder>();
+      break;
+    case FileCompression::ZSTD:
+      encoder_ = std::make_unique<ZstdEncoder>();
+      break;
+    default:
+      encoder_.reset();
+  }
+}
+
+void CompressedOutputFile::write(const char *data, std::size_t size) {
+  if (encoder_) {
+    encoder_->encode(data, size, false, file_);
+  } else if (std::fwrite(data, 1, size, file_) != size) {
+    throw GenericSolverException(LOGLOCATION + "ERROR : could not write in " +
+                                 filename_.string());
+  }
+}
+
+void CompressedOutputFile::close() {
+  if (encoder_) {
+    encoder_->encode(nullptr, 0, true, file_);
+    encoder_.reset();
+  }
+  const auto status = std::fclose(file_);
+  file_ = nullptr;
+  if (status != 0) {
+    throw GenericSolverException(LOGLOCATION + "ERROR : could not close " +
+                                 filename_.string());
+  }
+}
+
+/*************************************************************************************************
+-----------------------------------    Decompressed input
+----------------------------------------
+*************************************************************************************************/
+namespace {
+/* streams the decompressed content of filename into sink, by chunks */
+void decompress(const std::filesystem::path &filename,
+                const std::function<void(const char *, std::size_t)> &sink) {
+  std::ifstream input(filename, std::ios::binary);
+  if (!input) {
+    throw GenericSolverException(LOGLOCATION + "ERROR : could not open " +
+                                 filename.string());
+  }
+  std::vector<char> in_chunk(CHUNK_SIZE);
+  std::vector<char> out_chunk(CHUNK_SIZE);
+
+  const auto compression = detect_compression(filename);
+  if (compression == FileCompression::GZIP) {
+    z_stream stream{};
+    if (inflateInit2(&stream, AUTO_WINDOW_BITS) != Z_OK) {
+      throw GenericSolverException(LOGLOCATION +
+                                   "ERROR : could not initialize gzip");
+    }
+    int status = Z_OK;
+    while (status != Z_STREAM_END &&
+           input.read(in_chunk.data(), in_chunk.size()).gcount() > 0) {
+      stream.next_in = reinterpret_cast<Bytef *>(in_chunk.data());
+      stream.avail_in = static_cast<uInt>(input.gcount());
+      do {
+        stream.next_out = reinterpret_cast<Bytef *>(out_chunk.data());
+        stream.avail_out = static_cast<uInt>(out_chunk.size());
+        status = inflate(&stream, Z_NO_FLUSH);
+        // Z_BUF_ERROR: the input ended exactly with the previous output chunk
+        if (status != Z_OK && status != Z_STREAM_END &&
+            status != Z_BUF_ERROR) {
+          inflateEnd(&stream);
+          throw GenericSolverException(LOGLOCATION + "ERROR : " +
+                                       filename.string() +
+                                       " is not a valid gzip file");
+        }
+        sink(out_chunk.data(), out_chunk.size() - stream.avail_out);
+      } while (stream.avail_out == 0 && status != Z_STREAM_END);
+    }
+    inflateEnd(&stream);
+    if (status != Z_STREAM_END) {
+      throw GenericSolverException(LOGLOCATION + "ERROR : " +
+                                   filename.string() +
+                                   " is a truncated gzip file");
+    }
+  } else if (compression == FileCompression::ZSTD) {
+    std::unique_ptr<ZSTD_DCtx, decltype(&ZSTD_freeDCtx)> context(
+        ZSTD_createDCtx(), &ZSTD_freeDCtx);
+    if (context == nullptr) {
+      throw GenericSolverException(LOGLOCATION +
+                                   "ERROR : could not initialize zstd");
+    }
+    // 0 once a frame is complete, the hint of the next input size otherwise
+    std::size_t status = 1;
+    while (input.read(in_chunk.data(), in_chunk.size()).gcount() > 0) {
+      ZSTD_inBuffer in = {in_chunk.data(),
+                          static_cast<std::size_t>(input.gcount()), 0};
+      ZSTD_outBuffer out = {out_chunk.data(), out_chunk.size(), 0};
+      // a full output buffer may hide data still held by zstd
+      while (in.pos < in.size || out.pos == out.size) {
+        out = {out_chunk.data(), out_chunk.size(), 0};
+        status = ZSTD_decompressStream(context.get(), &out, &in);
+        if (ZSTD_isError(status)) {
+          throw GenericSolverException(
+              LOGLOCATION + "ERROR : " + filename.string() +
+              " is not a valid zstd file : " + ZSTD_getErrorName(status));
+        }
+        sink(out_chunk.data(), out.pos);
+      }
+    }
+    if (status != 0) {
+      throw GenericSolverException(LOGLOCATION + "ERROR : " +
+                                   filename.string() +
+                                   " is a truncated zstd file");
+    }
+  } else {
+    while (input.read(in_chunk.data(), in_chunk.size()).gcount() > 0) {
+      sink(in_chunk.data(), input.gcount());
+    }
+  }
+}
+}  // namespace
+
+void decompress_file(const std::filesystem::path &source,
+                     const std::filesystem::path &destination) {
+  std::ofstream output(destination, std::ios::binary);
+  if (!output) {
+    throw GenericSolverException(LOGLOCATION + "ERROR : could not open " +
+                                 destination.string());
+  }
+  decompress(source, [&output](const char *data, std::size_t size) {
+    output.write(data, static_cast<std::streamsize>(size));
+  });
+  if (!output) {
+    throw GenericSolverException(LOGLOCATION + "ERROR : could not write in " +
+                                 destination.string());
+  }
+}
+
+void compress_file(const std::filesystem::path &source,
+                   const std::filesystem::path &destination,
+                   FileCompression compression) {
+  std::ifstream input(source, std::ios::binary);
+  if (!input) {
+    throw GenericSolverException(LOGLOCATION + "ERROR : could not open " +
+                                 source.string());
+  }
+  CompressedOutputFile output;
+  output.open(destination, compression);
+  std::vector<char> chunk(CHUNK_SIZE);
+  while (input.read(chunk.data(), chunk.size()).gcount() > 0) {
+    output.write(chunk.data(), input.gcount());
+  }
+  output.close();
+}
+
+TemporaryProblemFile::TemporaryProblemFile(const std::string &extension) {
+  std::random_device seed;
+  std::mt19937_64 generator(seed());
+  constexpr int MAX_ATTEMPTS = 100;
+  for (int attempt(0); attempt < MAX_ATTEMPTS; ++attempt) {
+    std::ostringstream name;
+    name << "xpansion-" << std::hex << generator() << extension;
+    const auto candidate = std::filesystem::temp_directory_path() / name.str();
+    // "x": fails if the file exists, the name is reserved by its creation
+    if (std::FILE *file = std::fopen(candidate.string().c_str(), "wbx")) {
+      std::fclose(file);
+      path_ = candidate;
+      return;
+    }
+  }
+  throw GenericSolverException(
+      LOGLOCATION + "ERROR : could not create a temporary file in " +
+      std::filesystem::temp_directory_path().string());
+}
+
+TemporaryProblemFile::~TemporaryProblemFile() {
+  std::error_code error;
+  std::filesystem::remove(path_, error);
+}
+
+DecompressedProblemFile::DecompressedProblemFile(
+    const std::filesystem::path &filename)
+    : filename_(filename) {
+#ifdef __linux__
+  fd_ = memfd_create(filename.filename().string().c_str(), MFD_CLOEXEC);
+  if (fd_ < 0) {
+    throw GenericSolverException(LOGLOCATION +
+                                 "ERROR : could not create memory file for " +
+                                 filename.string());
+  }
+  path_ = "/proc/self/fd/" + std::to_string(fd_);
+  try {
+    decompress(filename, [this](const char *data, std::size_t size) {
+      append(data, size);
+    });
+  } catch (...) {
+    // the destructor does not run when the constructor throws
+    ::close(fd_);
+    throw;
+  }
+#else
+  temporary_file_ = std::make_unique<TemporaryProblemFile>(
+      filename.stem().extension().string());
+  path_ = temporary_file_->path();
+  decompress_file(filename, path_);
+#endif
+}
+
+DecompressedProblemFile::~DecompressedProblemFile() {
+#ifdef __linux__
+  if (fd_ >= 0) {
+    ::close(fd_);
+  }
+#endif
+}
+
+void DecompressedProblemFile::append(const char *data, std::size_t size) {
+#ifdef __linux__
+  while (size > 0) {
+    const auto written = ::write(fd_, data, size);
+    if (written < 0) {
+      throw GenericSolverException(LOGLOCATION +
+                                   "ERROR : could not decompress " +
+                                   filename_.string());
+    }
+    data += written;
+    size -= written;
+  }
+#endif
+}
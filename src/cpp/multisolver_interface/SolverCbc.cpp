@@ -1,8 +1,62 @@
 #include "SolverCbc.h"
 
+#include <algorithm>
+#include <cmath>
+
 #include "COIN_common_functions.h"
+#include "CglCutGenerator.hpp"
+#include "MpsWriter.h"
+#include "OsiCuts.hpp"
+#include "OsiRowCut.hpp"
+#include "multisolver_interface/ProblemFileCompression.h"
 using namespace std::literals;
 
+namespace {
+// distance to the closest integer of an integer column at an integer solution
+constexpr double INTEGER_TOLERANCE = 1e-6;
+
+/*!
+ * \brief cut generator of CBC calling a LazyConstraintCallback at the integer
+ * solutions of the branch and bound, its rows being globally valid cuts
+ */
+class LazyConstraintGenerator : public CglCutGenerator {
+ public:
+  explicit LazyConstraintGenerator(
+      std::shared_ptr<LazyConstraintCallback> callback)
+      : callback_(std::move(callback)) {}
+
+  CglCutGenerator *clone() const override {
+    return new LazyConstraintGenerator(*this);
+  }
+
+  void generateCuts(const OsiSolverInterface &si, OsiCuts &cs,
+                    const CglTreeInfo /*info*/) override {
+    const int ncols = si.getNumCols();
+    const double *solution = si.getColSolution();
+    for (int col(0); col < ncols; ++col) {
+      if (si.isInteger(col) &&
+          std::abs(solution[col] - std::round(solution[col])) >
+              INTEGER_TOLERANCE) {
+        return;
+      }
+    }
+    for (const auto &constraint :
+         (*callback_)(std::vector<double>(solution, solution + ncols))) {
+      OsiRowCut cut;
+      cut.setRow(static_cast<int>(constraint.indexes.size()),
+                 constraint.indexes.data(), constraint.values.data());
+      cut.setLb(-COIN_DBL_MAX);
+      cut.setUb(constraint.rhs);
+      cut.setGloballyValid(true);
+      cs.insert(cut);
+    }
+  }
+
+ private:
+  std::shared_ptr<LazyConstraintCallback> callback_;
+};
+}  // namespace
+
 /*************************************************************************************************
 -----------------------------------    Constructor/Desctructor
 --------------------------------
@@ -51,7 +105,61 @@ void SolverCbc::defineCbcModelFromInnerSolver() {
   // Affectation of new Clp interface to Cbc
   // As CbcModel _cbc is modified, need to set log level to 0 again
   _cbc = CbcModel(_clp_inner_solver);
+  _cbc_default_mip_relative_gap = _cbc.getAllowableFractionGap();
   set_output_log_level(_current_log_level);
+  if (_lazy_constraint_callback) {
+    // called at every node and at every solution, the generator is cloned
+    LazyConstraintGenerator generator(_lazy_constraint_callback);
+    _cbc.addCutGenerator(&generator, 1, "LazyConstraints", true, true);
+  }
+  invalidateCbcModel();
+}
+
+void SolverCbc::prepareCbcModelForBranchAndBound() {
+  if (_cbc_reference_rows < 0 || _cbc_reference_rows > get_nrows()) {
+    defineCbcModelFromInnerSolver();
+  } else {
+    // back to the problem before the previous branch and bound, the cut
+    // generators, heuristics and parameters of the model are kept
+    _cbc.resetToReferenceSolver();
+    appendNewRowsToCbcModel();
+  }
+  _cbc.saveReferenceSolver();
+  _cbc_reference_rows = get_nrows();
+  // the gap of a previous branch and bound is kept by the reset model
+  _cbc.setAllowableFractionGap(_mip_relative_gap >= 0
+                                   ? _mip_relative_gap
+                                   : _cbc_default_mip_relative_gap);
+
+  const auto &start =
+      _cbc_mip_start.empty() ? _cbc_incumbent : _cbc_mip_start;
+  // a start would not be checked against the lazy constraints
+  if (!_lazy_constraint_callback &&
+      start.size() == static_cast<size_t>(get_ncols())) {
+    // integers of the start are fixed and the continuous variables
+    // recomputed, it is only kept if still feasible with the new rows
+    _cbc.setBestSolution(start.data(), get_ncols(), COIN_DBL_MAX, true);
+  }
+  _cbc_mip_start.clear();
+}
+
+void SolverCbc::appendNewRowsToCbcModel() {
+  const int nrows = get_nrows();
+  if (_cbc_reference_rows == nrows) {
+    return;
+  }
+  const auto rows = get_rows_view();
+  const int first_element = rows.starts[_cbc_reference_rows];
+  std::vector<int> starts(rows.starts.begin() + _cbc_reference_rows,
+                          rows.starts.end());
+  for (auto &start : starts) {
+    start -= first_element;
+  }
+  _cbc.solver()->addRows(nrows - _cbc_reference_rows, starts.data(),
+                         rows.indexes.data() + first_element,
+                         rows.values.data() + first_element,
+                         _clp_inner_solver.getRowLower() + _cbc_reference_rows,
+                         _clp_inner_solver.getRowUpper() + _cbc_reference_rows);
 }
 
 /*************************************************************************************************
@@ -65,6 +173,9 @@ void SolverCbc::defineCbcModelFromInnerSolver() {
 *************************************************************************************************/
 void SolverCbc::init() {
   _clp_inner_solver = OsiClpSolverInterface();
+  clearNameIndexes();
+  _cbc_incumbent.clear();
+  _cbc_mip_start.clear();
   defineCbcModelFromInnerSolver();
 }
 
@@ -77,71 +188,36 @@ void SolverCbc::free() {
 -------------------------------
 *************************************************************************************************/
 void SolverCbc::write_prob_mps(const std::filesystem::path &filename) {
-  const int numcols = get_ncols();
-  std::shared_ptr<char[]> shared_integrality(new char[numcols]);
-  char *integrality = shared_integrality.get();
-  CoinCopyN(_clp_inner_solver.getColType(false), numcols, integrality);
-
-  bool hasInteger = false;
-  for (int i = 0; i < numcols; ++i) {
-    if (_clp_inner_solver.isInteger(i)) {
-      hasInteger = true;
-      break;
-    }
+  MpsProblemView problem;
+  _clp_inner_solver.getStrParam(OsiProbName, problem.problem_name);
+  _clp_inner_solver.getDblParam(OsiObjOffset, problem.obj_offset);
+  problem.infinity = _clp_inner_solver.getInfinity();
+  problem.ncols = get_ncols();
+  problem.nrows = get_nrows();
+
+  const CoinPackedMatrix *matrix = _clp_inner_solver.getMatrixByCol();
+  problem.col_starts = matrix->getVectorStarts();
+  problem.col_lengths = matrix->getVectorLengths();
+  problem.row_indices = matrix->getIndices();
+  problem.elements = matrix->getElements();
+
+  problem.obj = _clp_inner_solver.getObjCoefficients();
+  problem.col_lower = _clp_inner_solver.getColLower();
+  problem.col_upper = _clp_inner_solver.getColUpper();
+  problem.row_lower = _clp_inner_solver.getRowLower();
+  problem.row_upper = _clp_inner_solver.getRowUpper();
+  if (get_n_integer_vars() > 0) {
+    problem.integrality = _clp_inner_solver.getColType(false);
   }
 
-  CoinMpsIO writer;
-  writer.setInfinity(_clp_inner_solver.getInfinity());
-  writer.passInMessageHandler(_clp_inner_solver.messageHandler());
-
   // If the user added cuts or rows but did not added names to them
   // the number of names returned by solver might be different from the
-  // actual number of names, resulting in a crash
-  std::vector<std::string> rowNames(get_nrows());
-  for (int i = 0; i < get_nrows(); ++i) {
-    std::string const &name(_clp_inner_solver.getRowName(i));
-    if (name == "") {
-      std::stringstream buffer;
-      buffer << "R" << i;
-      rowNames[i] = buffer.str();
-    } else {
-      rowNames[i] = name;
-    }
-  }
-
-  std::vector<std::string> colNames(get_ncols());
-  for (int i = 0; i < get_ncols(); ++i) {
-    std::string const &name(_clp_inner_solver.getColName(i));
-    if (name == "") {
-      std::stringstream buffer;
-      buffer << "C" << i;
-      colNames[i] = buffer.str();
-    } else {
-      colNames[i] = name;
-    }
-  }
-
-  {
-    auto mcol = _clp_inner_solver.getMatrixByCol();
-    auto col = *(_clp_inner_solver.getMatrixByCol());
-    auto infinity = _clp_inner_solver.getInfinity();
-    writer.setMpsData(
-        col, infinity, _clp_inner_solver.getColLower(),
-        _clp_inner_solver.getColUpper(), _clp_inner_solver.getObjCoefficients(),
-        hasInteger ? integrality : nullptr, _clp_inner_solver.getRowLower(),
-        _clp_inner_solver.getRowUpper(), colNames, rowNames);
-  }
-
-  std::string probName = "";
-  _clp_inner_solver.getStrParam(OsiProbName, probName);
-  writer.setProblemName(probName.c_str());
+  // actual number of names, missing names are generated by the writer
+  problem.col_names = &_clp_inner_solver.getColNames();
+  problem.row_names = &_clp_inner_solver.getRowNames();
 
-  double objOffset = 0.0;
-  _clp_inner_solver.getDblParam(OsiObjOffset, objOffset);
-  writer.setObjectiveOffset(objOffset);
-
-  writer.writeMps(filename.string().c_str(), 0 /*gzip it*/, 1, 1, nullptr, 0,
-                  nullptr);
+  MpsWriter writer;
+  writer.write(problem, filename);
 }
 
 void SolverCbc::write_prob_lp(const std::filesystem::path &filename) {
@@ -184,15 +260,30 @@ void SolverCbc::setClpSimplexRowNamesFromInnerSolver(ClpSimplex *clps) const {
 
 void SolverCbc::read_prob_mps(const std::filesystem::path &filename,
                               bool compressed) {
-  int status = _clp_inner_solver.readMps(filename.string().c_str());
-  zero_status_check(status, " read problem "s + filename.string(),
+  const auto problem_file = find_problem_file(filename);
+  int status = 0;
+  if (detect_compression(problem_file) != FileCompression::NONE) {
+    // decompressed file has no extension, it must not get .mps appended
+    DecompressedProblemFile decompressed(problem_file);
+    status = _clp_inner_solver.readMps(decompressed.path().string().c_str(),
+                                       "");
+  } else {
+    status = _clp_inner_solver.readMps(filename.string().c_str());
+  }
+  zero_status_check(status, " read problem "s + problem_file.string(),
                     LOGLOCATION);
+  clearNameIndexes();
+  _cbc_incumbent.clear();
+  _cbc_mip_start.clear();
   defineCbcModelFromInnerSolver();
 }
 
 void SolverCbc::read_prob_lp(const std::filesystem::path &prob_name) {
   int status = _clp_inner_solver.readLp(prob_name.string().c_str());
   zero_status_check(status, "read problem", LOGLOCATION);
+  clearNameIndexes();
+  _cbc_incumbent.clear();
+  _cbc_mip_start.clear();
   defineCbcModelFromInnerSolver();
 }
 
@@ -242,12 +333,14 @@ void SolverCbc::get_obj(double *obj, int first, int last) const {
 }
 
 void SolverCbc::set_obj_to_zero() {
+  invalidateCbcModel();
   auto ncols = get_ncols();
   std::vector<double> zeros_val(ncols, 0.0);
   _clp_inner_solver.setObjective(zeros_val.data());
 }
 
 void SolverCbc::set_obj(const double *obj, int first, int last) {
+  invalidateCbcModel();
   if (last - first + 1 == get_ncols()) {
     _clp_inner_solver.setObjective(obj);
   } else {
@@ -259,7 +352,7 @@ void SolverCbc::set_obj(const double *obj, int first, int last) {
 
 void SolverCbc::get_rows(int *mstart, int *mclind, double *dmatval, int size,
                          int *nels, int first, int last) const {
-  CoinPackedMatrix matrix = *_clp_inner_solver.getMatrixByRow();
+  const CoinPackedMatrix &matrix = *_clp_inner_solver.getMatrixByRow();
   coin_common::fill_rows_from_COIN_matrix(matrix, mstart, mclind, dmatval, nels,
                                           first, last);
 }
@@ -321,29 +414,64 @@ void SolverCbc::get_ub(double *ub, int first, int last) const {
   }
 }
 
-// TODO update see SolverCbc::get_col_index
+SparseMatrixView SolverCbc::get_rows_view() const {
+  return coin_common::view_of_COIN_matrix(*_clp_inner_solver.getMatrixByRow());
+}
+
+SparseMatrixView SolverCbc::get_cols_view() const {
+  return coin_common::view_of_COIN_matrix(*_clp_inner_solver.getMatrixByCol());
+}
+
+ArrayView<double> SolverCbc::get_obj_view() const {
+  return ArrayView<double>(
+      std::span(_clp_inner_solver.getObjCoefficients(), get_ncols()));
+}
+
+ArrayView<double> SolverCbc::get_lb_view() const {
+  return ArrayView<double>(
+      std::span(_clp_inner_solver.getColLower(), get_ncols()));
+}
+
+ArrayView<double> SolverCbc::get_ub_view() const {
+  return ArrayView<double>(
+      std::span(_clp_inner_solver.getColUpper(), get_ncols()));
+}
+
+std::vector<std::string> SolverCbc::innerColNames(int first, int last) const {
+  std::vector<std::string> names;
+  names.reserve(std::max(0, 1 + last - first));
+  for (int i(first); i < last + 1; i++) {
+    names.push_back(_clp_inner_solver.getColName(i));
+  }
+  return names;
+}
+
+std::vector<std::string> SolverCbc::innerRowNames(int first, int last) const {
+  std::vector<std::string> names;
+  names.reserve(std::max(0, 1 + last - first));
+  for (int i(first); i < last + 1; i++) {
+    names.push_back(_clp_inner_solver.getRowName(i));
+  }
+  return names;
+}
+
+void SolverCbc::clearNameIndexes() {
+  col_index_.clear();
+  row_index_.clear();
+}
+
 int SolverCbc::get_row_index(std::string const &name) {
-  int id = 0;
-  int nrows = get_nrows();
-  while (id < nrows) {
-    if (_clp_inner_solver.getRowName(id) == name) {
-      return id;
-    }
-    id++;
+  if (!row_index_.built()) {
+    row_index_.build(innerRowNames(0, get_nrows() - 1));
   }
-  return -1;
+  return row_index_.find(name);
 }
 
 int SolverCbc::get_col_index(std::string const &name) {
-  const auto &col_names = get_col_names();
-  const auto index = std::distance(
-      col_names.begin(), std::find(col_names.cbegin(), col_names.cend(), name));
-
-  if (index >= col_names.end() - col_names.begin()) {
-    return -1;
-  } else {
-    return index;
+  if (!col_index_.built()) {
+    col_index_.build(innerColNames(0, get_ncols() - 1));
   }
+  return col_index_.find(name);
 }
 
 std::vector<std::string> SolverCbc::get_row_names(int first, int last) {
@@ -390,13 +518,33 @@ std::vector<std::string> SolverCbc::get_col_names() {
 *************************************************************************************************/
 
 void SolverCbc::del_rows(int first, int last) {
+  invalidateCbcModel();
   std::vector<int> mindex(last - first + 1);
   for (int i = 0; i < last - first + 1; i++) {
     mindex[i] = first + i;
   }
+  if (row_index_.built()) {
+    row_index_.erase(first, last, innerRowNames(first, last));
+  }
   _clp_inner_solver.deleteRows(last - first + 1, mindex.data());
 }
 
+void SolverCbc::del_cols(int first, int last) {
+  invalidateCbcModel();
+  std::vector<int> mindex(last - first + 1);
+  for (int i = 0; i < last - first + 1; i++) {
+    mindex[i] = first + i;
+  }
+  if (col_index_.built()) {
+    col_index_.erase(first, last, innerColNames(first, last));
+  }
+  if (_cbc_incumbent.size() == static_cast<size_t>(get_ncols())) {
+    _cbc_incumbent.erase(_cbc_incumbent.begin() + first,
+                         _cbc_incumbent.begin() + last + 1);
+  }
+  _clp_inner_solver.deleteCols(last - first + 1, mindex.data());
+}
+
 void SolverCbc::add_rows(int newrows, int newnz, const char *qrtype,
                          const double *rhs, const double *range,
                          const int *mstart, const int *mclind,
@@ -410,26 +558,34 @@ void SolverCbc::add_rows(int newrows, int newnz, const char *qrtype,
                                                   qrtype, rhs);
   _clp_inner_solver.addRows(newrows, mstart, mclind, dmatval, rowLower.data(),
                             rowUpper.data());
+  int nrowFinal = get_nrows();
   if (row_names.size() > 0) {
-    int nrowFinal = get_nrows();
     for (int i = nrowInit; i < nrowFinal; i++) {
-      chg_row_name(i, row_names[i - nrowInit]);
+      _clp_inner_solver.setRowName(i, row_names[i - nrowInit]);
     }
   }
+  if (row_index_.built()) {
+    row_index_.append(nrowInit, innerRowNames(nrowInit, nrowFinal - 1));
+  }
 }
 
 void SolverCbc::add_cols(int newcol, int newnz, const double *objx,
                          const int *mstart, const int *mrwind,
                          const double *dmatval, const double *bdl,
                          const double *bdu) {
+  invalidateCbcModel();
   std::vector<int> colStart(newcol + 1);
   for (int i(0); i < newcol; i++) {
     colStart[i] = mstart[i];
   }
   colStart[newcol] = newnz;
 
+  int ncolInit = get_ncols();
   _clp_inner_solver.addCols(newcol, colStart.data(), mrwind, dmatval, bdl, bdu,
                             objx);
+  if (col_index_.built()) {
+    col_index_.append(ncolInit, innerColNames(ncolInit, get_ncols() - 1));
+  }
 }
 
 void SolverCbc::add_name(int type, const char *cnames, int indice) {
@@ -448,6 +604,7 @@ void SolverCbc::add_names(int type, const std::vector<std::string> &cnames,
 
 void SolverCbc::chg_obj(const std::vector<int> &mindex,
                         const std::vector<double> &obj) {
+  invalidateCbcModel();
   assert(obj.size() == mindex.size());
   for (int i(0); i < obj.size(); i++) {
     _clp_inner_solver.setObjCoeff(mindex[i], obj[i]);
@@ -455,6 +612,7 @@ void SolverCbc::chg_obj(const std::vector<int> &mindex,
 }
 
 void SolverCbc::chg_obj_direction(const bool minimize) {
+  invalidateCbcModel();
   int objsense = minimize ? 1 : -1;
   _clp_inner_solver.setObjSense(objsense);
 }
@@ -462,6 +620,7 @@ void SolverCbc::chg_obj_direction(const bool minimize) {
 void SolverCbc::chg_bounds(const std::vector<int> &mindex,
                            const std::vector<char> &qbtype,
                            const std::vector<double> &bnd) {
+  invalidateCbcModel();
   assert(qbtype.size() == mindex.size());
   assert(bnd.size() == mindex.size());
   for (int i(0); i < mindex.size(); i++) {
@@ -480,6 +639,7 @@ void SolverCbc::chg_bounds(const std::vector<int> &mindex,
 
 void SolverCbc::chg_col_type(const std::vector<int> &mindex,
                              const std::vector<char> &qctype) {
+  invalidateCbcModel();
   assert(qctype.size() == mindex.size());
   std::vector<int> bnd_index(1, 0);
   std::vector<char> bnd_type(1, 'U');
@@ -503,6 +663,7 @@ void SolverCbc::chg_col_type(const std::vector<int> &mindex,
 }
 
 void SolverCbc::chg_rhs(int id_row, double val) {
+  invalidateCbcModel();
   const double *rowLower = _clp_inner_solver.getRowLower();
   const double *rowUpper = _clp_inner_solver.getRowUpper();
 
@@ -529,6 +690,7 @@ void SolverCbc::chg_rhs(int id_row, double val) {
 }
 
 void SolverCbc::chg_coef(int id_row, int id_col, double val) {
+  invalidateCbcModel();
   // Very tricky method by method "modifyCoefficient" of OsiClp does not work
   CoinPackedMatrix matrix = *_clp_inner_solver.getMatrixByRow();
 
@@ -537,10 +699,16 @@ void SolverCbc::chg_coef(int id_row, int id_col, double val) {
 }
 
 void SolverCbc::chg_row_name(int id_row, std::string const &name) {
+  if (row_index_.built()) {
+    row_index_.rename(id_row, _clp_inner_solver.getRowName(id_row), name);
+  }
   _clp_inner_solver.setRowName(id_row, name);
 }
 
 void SolverCbc::chg_col_name(int id_col, std::string const &name) {
+  if (col_index_.built()) {
+    col_index_.rename(id_col, _clp_inner_solver.getColName(id_col), name);
+  }
   _clp_inner_solver.setColName(id_col, name);
 }
 
@@ -576,8 +744,11 @@ int SolverCbc::solve_mip() {
   // Passing OsiClp to Cbc to solve
   // Cbc keeps only solutions of problem
 
-  defineCbcModelFromInnerSolver();
+  prepareCbcModelForBranchAndBound();
   _cbc.branchAndBound();
+  if (const double *best = _cbc.bestSolution()) {
+    _cbc_incumbent.assign(best, best + get_ncols());
+  }
 
   if (_cbc.isProvenOptimal()) {
     if (std::abs(_cbc.solver()->getObjValue()) >= 1e20) {
@@ -601,6 +772,22 @@ int SolverCbc::solve_mip() {
   return lp_status;
 }
 
+void SolverCbc::set_mip_start(const std::vector<int> &mindex,
+                              const std::vector<double> &values) {
+  assert(mindex.size() == values.size());
+  // the columns not given start at the value of their bounds closest to 0
+  const int ncols = get_ncols();
+  const double *colLower = _clp_inner_solver.getColLower();
+  const double *colUpper = _clp_inner_solver.getColUpper();
+  _cbc_mip_start.resize(ncols);
+  for (int i(0); i < ncols; i++) {
+    _cbc_mip_start[i] = std::min(std::max(0.0, colLower[i]), colUpper[i]);
+  }
+  for (size_t i(0); i < mindex.size(); i++) {
+    _cbc_mip_start[mindex[i]] = values[i];
+  }
+}
+
 /*************************************************************************************************
 -------------------------    Methods to get solutions information
 -----------------------------
@@ -686,6 +873,28 @@ void SolverCbc::set_optimality_gap(double gap) {
       "set_optimality_gap : " + std::to_string(gap), LOGLOCATION);
 }
 
+void SolverCbc::set_mip_relative_gap(double gap) {
+  // applied to _cbc before each branch and bound, _cbc may be rebuilt
+  _mip_relative_gap = gap;
+}
+
+void SolverCbc::set_dual_tolerance(double tolerance) {
+  if (_default_dual_tolerance < 0) {
+    _clp_inner_solver.getDblParam(OsiDualTolerance, _default_dual_tolerance);
+  }
+  _clp_inner_solver.setDblParam(
+      OsiDualTolerance, tolerance >= 0 ? tolerance : _default_dual_tolerance);
+}
+
+void SolverCbc::set_lazy_constraint_callback(LazyConstraintCallback callback) {
+  _lazy_constraint_callback =
+      callback ? std::make_shared<LazyConstraintCallback>(std::move(callback))
+               : nullptr;
+  // the cut generators are only set when _cbc is built: it is rebuilt at the
+  // next branch and bound, the solution of the previous one being kept
+  invalidateCbcModel();
+}
+
 void SolverCbc::set_simplex_iter(int iter) {
   throw InvalidSolverOptionException(
       "set_simplex_iter : " + std::to_string(iter), LOGLOCATION);
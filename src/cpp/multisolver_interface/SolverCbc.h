@@ -6,6 +6,7 @@
 #include "Cbc_C_Interface.h"
 #include "CoinHelperFunctions.hpp"
 #include "CoinMpsIO.hpp"
+#include "NameIndex.h"
 #include "OsiClpSolverInterface.hpp"
 #include "multisolver_interface/SolverAbstract.h"
 
@@ -59,7 +60,37 @@ class SolverCbc : public SolverAbstract {
   virtual std::string get_solver_name() const override { return name_; }
 
  private:
+  NameIndex col_index_;
+  NameIndex row_index_;
+
+  // rows of the inner solver already in the reference solver of _cbc, -1
+  // when _cbc must be rebuilt before the next branch and bound
+  int _cbc_reference_rows = -1;
+  // best solution of the previous branch and bound, warm start of the next
+  std::vector<double> _cbc_incumbent;
+  // solution given by set_mip_start, used instead of the incumbent
+  std::vector<double> _cbc_mip_start;
+  // stopping gap of the branch and bound, negative to keep CBC's default
+  double _mip_relative_gap = -1;
+  double _cbc_default_mip_relative_gap = 0;
+  // dual tolerance of the inner solver before the first set_dual_tolerance
+  double _default_dual_tolerance = -1;
+  // called by a cut generator of _cbc at the integer solutions, not copied
+  // with the solver
+  std::shared_ptr<LazyConstraintCallback> _lazy_constraint_callback;
+
   void defineCbcModelFromInnerSolver();
+  /**
+   * @brief keeps _cbc from one branch and bound to the next when only rows
+   * were added to the problem meanwhile, and feeds it the previous incumbent
+   */
+  void prepareCbcModelForBranchAndBound();
+  void appendNewRowsToCbcModel();
+  void invalidateCbcModel() { _cbc_reference_rows = -1; }
+  // names known by the inner solver, default ones for unnamed elements
+  std::vector<std::string> innerColNames(int first, int last) const;
+  std::vector<std::string> innerRowNames(int first, int last) const;
+  void clearNameIndexes();
   void setClpSimplexColNamesFromInnerSolver(ClpSimplex *clps) const;
   void setClpSimplexRowNamesFromInnerSolver(ClpSimplex *clps) const;
 
@@ -112,6 +143,11 @@ class SolverCbc : public SolverAbstract {
   virtual void get_col_type(char *coltype, int first, int last) const override;
   virtual void get_lb(double *lb, int fisrt, int last) const override;
   virtual void get_ub(double *ub, int fisrt, int last) const override;
+  SparseMatrixView get_rows_view() const override;
+  SparseMatrixView get_cols_view() const override;
+  ArrayView<double> get_obj_view() const override;
+  ArrayView<double> get_lb_view() const override;
+  ArrayView<double> get_ub_view() const override;
 
   virtual int get_row_index(std::string const &name) override;
   virtual int get_col_index(std::string const &name) override;
@@ -126,6 +162,7 @@ class SolverCbc : public SolverAbstract {
   *************************************************************************************************/
  public:
   virtual void del_rows(int first, int last) override;
+  virtual void del_cols(int first, int last) override;
   virtual void add_rows(int newrows, int newnz, const char *qrtype,
                         const double *rhs, const double *range,
                         const int *mstart, const int *mclind,
@@ -158,6 +195,8 @@ class SolverCbc : public SolverAbstract {
  public:
   virtual int solve_lp() override;
   virtual int solve_mip() override;
+  void set_mip_start(const std::vector<int> &mindex,
+                     const std::vector<double> &values) override;
 
   /*************************************************************************************************
   -------------------------    Methods to get solutions information
@@ -195,5 +234,9 @@ class SolverCbc : public SolverAbstract {
   virtual void set_algorithm(std::string const &algo) override;
   virtual void set_threads(int n_threads) override;
   virtual void set_optimality_gap(double gap) override;
+  virtual void set_mip_relative_gap(double gap) override;
+  virtual void set_dual_tolerance(double tolerance) override;
+  virtual void set_lazy_constraint_callback(
+      LazyConstraintCallback callback) override;
   virtual void set_simplex_iter(int iter) override;
 };
@@ -1,6 +1,8 @@
 #include "SolverClp.h"
 
 #include "COIN_common_functions.h"
+#include "MpsWriter.h"
+#include "multisolver_interface/ProblemFileCompression.h"
 using namespace std::literals;
 
 /*************************************************************************************************
@@ -52,7 +54,11 @@ int SolverClp::get_number_of_instances() { return _NumberOfProblems; }
 ------------    Destruction of inner strctures and datas, closing environments
 ---------------
 *************************************************************************************************/
-void SolverClp::init() { _clp = ClpSimplex(); }
+void SolverClp::init() {
+  _clp = ClpSimplex();
+  col_index_.clear();
+  row_index_.clear();
+}
 
 void SolverClp::free() {
   //_clp = ClpSimplex();
@@ -63,7 +69,44 @@ void SolverClp::free() {
 -------------------------------
 *************************************************************************************************/
 void SolverClp::write_prob_mps(const std::filesystem::path &filename) {
-  _clp.writeMps(filename.string().c_str(), 1);
+  MpsProblemView problem;
+  problem.problem_name = _clp.problemName();
+  problem.obj_offset = _clp.objectiveOffset();
+  problem.infinity = COIN_DBL_MAX;
+  problem.ncols = get_ncols();
+  problem.nrows = get_nrows();
+
+  const CoinPackedMatrix *matrix = _clp.matrix();
+  problem.col_starts = matrix->getVectorStarts();
+  problem.col_lengths = matrix->getVectorLengths();
+  problem.row_indices = matrix->getIndices();
+  problem.elements = matrix->getElements();
+
+  // MPS files are always written as minimization problems
+  std::vector<double> objective;
+  if (_clp.optimizationDirection() < 0) {
+    problem.obj_offset = -problem.obj_offset;
+    objective.assign(_clp.objective(), _clp.objective() + problem.ncols);
+    for (auto &coefficient : objective) {
+      coefficient = -coefficient;
+    }
+    problem.obj = objective.data();
+  } else {
+    problem.obj = _clp.objective();
+  }
+  problem.col_lower = _clp.getColLower();
+  problem.col_upper = _clp.getColUpper();
+  problem.row_lower = _clp.getRowLower();
+  problem.row_upper = _clp.getRowUpper();
+  problem.integrality = _clp.integerInformation();
+
+  if (_clp.lengthNames() > 0) {
+    problem.col_names = _clp.columnNames();
+    problem.row_names = _clp.rowNames();
+  }
+
+  MpsWriter writer;
+  writer.write(problem, filename);
 }
 
 void SolverClp::write_prob_lp(const std::filesystem::path &filename) {
@@ -85,12 +128,24 @@ void SolverClp::write_basis(const std::filesystem::path &filename) {
 
 void SolverClp::read_prob_mps(const std::filesystem::path &filename,
                               bool compressed) {
-  int status = _clp.readMps(filename.string().c_str(), true, false);
-  zero_status_check(status, " Clp readMps "s + filename.string(), LOGLOCATION);
+  const auto problem_file = find_problem_file(filename);
+  int status = 0;
+  if (detect_compression(problem_file) != FileCompression::NONE) {
+    DecompressedProblemFile decompressed(problem_file);
+    status = _clp.readMps(decompressed.path().string().c_str(), true, false);
+  } else {
+    status = _clp.readMps(filename.string().c_str(), true, false);
+  }
+  zero_status_check(status, " Clp readMps "s + problem_file.string(),
+                    LOGLOCATION);
+  col_index_.clear();
+  row_index_.clear();
 }
 
 void SolverClp::read_prob_lp(const std::filesystem::path &filename) {
   _clp.readLp(filename.string().c_str());
+  col_index_.clear();
+  row_index_.clear();
 }
 
 void SolverClp::read_basis(const std::filesystem::path &filename) {
@@ -208,28 +263,39 @@ void SolverClp::get_ub(double *ub, int first, int last) const {
   }
 }
 
-int SolverClp::get_row_index(std::string const &name) {
-  const auto &col_names = get_row_names();
-  const auto index = std::distance(
-      col_names.begin(), std::find(col_names.cbegin(), col_names.cend(), name));
+SparseMatrixView SolverClp::get_rows_view() const {
+  // CLP only stores the matrix column by column
+  return TransposedMatrix(get_cols_view(), get_nrows());
+}
 
-  if (index >= col_names.end() - col_names.begin()) {
-    return -1;
-  } else {
-    return index;
+SparseMatrixView SolverClp::get_cols_view() const {
+  return coin_common::view_of_COIN_matrix(*_clp.matrix());
+}
+
+ArrayView<double> SolverClp::get_obj_view() const {
+  return ArrayView<double>(std::span(_clp.objective(), get_ncols()));
+}
+
+ArrayView<double> SolverClp::get_lb_view() const {
+  return ArrayView<double>(std::span(_clp.getColLower(), get_ncols()));
+}
+
+ArrayView<double> SolverClp::get_ub_view() const {
+  return ArrayView<double>(std::span(_clp.getColUpper(), get_ncols()));
+}
+
+int SolverClp::get_row_index(std::string const &name) {
+  if (!row_index_.built()) {
+    row_index_.build(get_row_names(0, get_nrows() - 1));
   }
+  return row_index_.find(name);
 }
 
 int SolverClp::get_col_index(std::string const &name) {
-  const auto &col_names = get_col_names();
-  const auto index = std::distance(
-      col_names.begin(), std::find(col_names.cbegin(), col_names.cend(), name));
-
-  if (index >= col_names.end() - col_names.begin()) {
-    return -1;
-  } else {
-    return index;
+  if (!col_index_.built()) {
+    col_index_.build(get_col_names(0, get_ncols() - 1));
   }
+  return col_index_.find(name);
 }
 
 std::vector<std::string> SolverClp::get_row_names(int first, int last) {
@@ -268,9 +334,23 @@ void SolverClp::del_rows(int first, int last) {
   for (int i = 0; i < last - first + 1; i++) {
     mindex[i] = first + i;
   }
+  if (row_index_.built()) {
+    row_index_.erase(first, last, get_row_names(first, last));
+  }
   _clp.deleteRows(last - first + 1, mindex.data());
 }
 
+void SolverClp::del_cols(int first, int last) {
+  std::vector<int> mindex(last - first + 1);
+  for (int i = 0; i < last - first + 1; i++) {
+    mindex[i] = first + i;
+  }
+  if (col_index_.built()) {
+    col_index_.erase(first, last, get_col_names(first, last));
+  }
+  _clp.deleteColumns(last - first + 1, mindex.data());
+}
+
 void SolverClp::add_rows(int newrows, int newnz, const char *qrtype,
                          const double *rhs, const double *range,
                          const int *mstart, const int *mclind,
@@ -284,12 +364,16 @@ void SolverClp::add_rows(int newrows, int newnz, const char *qrtype,
 
   _clp.addRows(newrows, rowLower.data(), rowUpper.data(), mstart, mclind,
                dmatval);
+  int nrowFinal = get_nrows();
   if (row_names.size() > 0) {
-    int nrowFinal = get_nrows();
     for (int i = nrowInit; i < nrowFinal; i++) {
-      chg_row_name(i, row_names[i - nrowInit]);
+      std::string copy_name = row_names[i - nrowInit];
+      _clp.setRowName(i, copy_name);
     }
   }
+  if (row_index_.built()) {
+    row_index_.append(nrowInit, get_row_names(nrowInit, nrowFinal - 1));
+  }
 }
 
 void SolverClp::add_cols(int newcol, int newnz, const double *objx,
@@ -302,7 +386,11 @@ void SolverClp::add_cols(int newcol, int newnz, const double *objx,
   }
   colStart[newcol] = newnz;
 
+  int ncolInit = get_ncols();
   _clp.addColumns(newcol, bdl, bdu, objx, colStart.data(), mrwind, dmatval);
+  if (col_index_.built()) {
+    col_index_.append(ncolInit, get_col_names(ncolInit, get_ncols() - 1));
+  }
 }
 
 void SolverClp::add_name(int type, const char *cnames, int indice) {
@@ -407,11 +495,17 @@ void SolverClp::chg_coef(int id_row, int id_col, double val) {
 }
 
 void SolverClp::chg_row_name(int id_row, std::string const &name) {
+  if (row_index_.built()) {
+    row_index_.rename(id_row, _clp.getRowName(id_row), name);
+  }
   std::string copy_name = name;
   _clp.setRowName(id_row, copy_name);
 }
 
 void SolverClp::chg_col_name(int id_col, std::string const &name) {
+  if (col_index_.built()) {
+    col_index_.rename(id_col, _clp.getColumnName(id_col), name);
+  }
   std::string copy_name = name;
   _clp.setColumnName(id_col, copy_name);
 }
@@ -456,6 +550,11 @@ int SolverClp::solve_mip() {
   return lp_status;
 }
 
+void SolverClp::set_mip_start(const std::vector<int> &mindex,
+                              const std::vector<double> &values) {
+  // CLP solves the MIP as its LP relaxation, there is nothing to start from
+}
+
 /*************************************************************************************************
 -------------------------    Methods to get solutions information
 -----------------------------
@@ -542,4 +641,15 @@ void SolverClp::set_optimality_gap(double gap) {
       "set_optimality_gap : " + std::to_string(gap), LOGLOCATION);
 }
 
+void SolverClp::set_mip_relative_gap(double gap) {
+  // CLP solves the MIP as an LP, it is always solved to optimality
+}
+
+void SolverClp::set_dual_tolerance(double tolerance) {
+  if (_default_dual_tolerance < 0) {
+    _default_dual_tolerance = _clp.dualTolerance();
+  }
+  _clp.setDualTolerance(tolerance >= 0 ? tolerance : _default_dual_tolerance);
+}
+
 void SolverClp::set_simplex_iter(int iter) { _clp.setMaximumIterations(iter); }
@@ -3,6 +3,7 @@
 #include "ClpSimplex.hpp"
 #include "CoinHelperFunctions.hpp"
 #include "CoinIndexedVector.hpp"
+#include "NameIndex.h"
 #include "multisolver_interface/SolverAbstract.h"
 
 enum CLP_STATUS {
@@ -30,6 +31,12 @@ class SolverClp : public SolverAbstract {
   ClpSimplex _clp;
   const std::string name_ = "CLP";
 
+ private:
+  NameIndex col_index_;
+  NameIndex row_index_;
+  // dual tolerance of _clp before the first set_dual_tolerance
+  double _default_dual_tolerance = -1;
+
   /*************************************************************************************************
   -----------------------------------    Constructor/Desctructor
   --------------------------------
@@ -109,6 +116,11 @@ class SolverClp : public SolverAbstract {
   virtual void get_col_type(char *coltype, int first, int last) const override;
   virtual void get_lb(double *lb, int fisrt, int last) const override;
   virtual void get_ub(double *ub, int fisrt, int last) const override;
+  SparseMatrixView get_rows_view() const override;
+  SparseMatrixView get_cols_view() const override;
+  ArrayView<double> get_obj_view() const override;
+  ArrayView<double> get_lb_view() const override;
+  ArrayView<double> get_ub_view() const override;
 
   virtual int get_row_index(std::string const &name) override;
   virtual int get_col_index(std::string const &name) override;
@@ -123,6 +135,7 @@ class SolverClp : public SolverAbstract {
   *************************************************************************************************/
  public:
   virtual void del_rows(int first, int last) override;
+  virtual void del_cols(int first, int last) override;
   virtual void add_rows(int newrows, int newnz, const char *qrtype,
                         const double *rhs, const double *range,
                         const int *mstart, const int *mclind,
@@ -155,6 +168,8 @@ class SolverClp : public SolverAbstract {
  public:
   virtual int solve_lp() override;
   virtual int solve_mip() override;
+  void set_mip_start(const std::vector<int> &mindex,
+                     const std::vector<double> &values) override;
 
   /*************************************************************************************************
   -------------------------    Methods to get solutions information
@@ -192,5 +207,7 @@ class SolverClp : public SolverAbstract {
   virtual void set_algorithm(std::string const &algo) override;
   virtual void set_threads(int n_threads) override;
   virtual void set_optimality_gap(double gap) override;
+  virtual void set_mip_relative_gap(double gap) override;
+  virtual void set_dual_tolerance(double tolerance) override;
   virtual void set_simplex_iter(int iter) override;
 };
@@ -5,6 +5,7 @@
 #include <map>
 #include <numeric>
 
+#include "multisolver_interface/ProblemFileCompression.h"
 #include "StringManip.h"
 
 using namespace LoadXpress;
@@ -115,9 +116,18 @@ void SolverXpress::free() {
 -------------------------------
 *************************************************************************************************/
 void SolverXpress::write_prob_mps(const std::filesystem::path &filename) {
-  std::string nFlags = "";
-  int status = XPRSsaveas(_xprs, filename.string().c_str());
+  const auto compression = compression_from_extension(filename);
+  if (compression == FileCompression::NONE) {
+    int status = XPRSsaveas(_xprs, filename.string().c_str());
+    zero_status_check(status, "write problem", LOGLOCATION);
+    return;
+  }
+  // XPRESS cannot write compressed files: the problem is written in a
+  // temporary MPS file, then compressed
+  const TemporaryProblemFile plain_file(".mps");
+  int status = XPRSwriteprob(_xprs, plain_file.path().string().c_str(), "");
   zero_status_check(status, "write problem", LOGLOCATION);
+  compress_file(plain_file.path(), filename, compression);
 }
 
 void SolverXpress::write_prob_lp(const std::filesystem::path &filename) {
@@ -138,7 +148,14 @@ void SolverXpress::read_prob_mps(const std::filesystem::path &filename,
   std::string nFlags = "z";
   if (!compressed)
     nFlags = "";
-  if (!compressed)
+  const auto problem_file = find_problem_file(filename);
+  if (detect_compression(problem_file) != FileCompression::NONE) {
+    // XPRESS guesses the format from the extension, the file is decompressed
+    // in a temporary MPS file
+    const TemporaryProblemFile plain_file(".mps");
+    decompress_file(problem_file, plain_file.path());
+    read_prob(plain_file.path().string().c_str(), "");
+  } else if (!compressed)
     read_prob(filename.string().c_str(), nFlags.c_str());
   else {
     std::string nFlags = "";
@@ -361,6 +378,15 @@ void SolverXpress::del_rows(int first, int last) {
   zero_status_check(status, "delete rows", LOGLOCATION);
 }
 
+void SolverXpress::del_cols(int first, int last) {
+  std::vector<int> mindex(last - first + 1);
+  for (int i = 0; i < last - first + 1; i++) {
+    mindex[i] = first + i;
+  }
+  int status = XPRSdelcols(_xprs, last - first + 1, mindex.data());
+  zero_status_check(status, "delete columns", LOGLOCATION);
+}
+
 void SolverXpress::add_rows(int newrows, int newnz, const char *qrtype,
                             const double *rhs, const double *range,
                             const int *mstart, const int *mclind,
@@ -507,6 +533,15 @@ int SolverXpress::solve_mip() {
   return lp_status;
 }
 
+void SolverXpress::set_mip_start(const std::vector<int> &mindex,
+                                 const std::vector<double> &values) {
+  assert(mindex.size() == values.size());
+  // stored by Xpress until the next MIP solve, which completes it
+  int status = XPRSaddmipsol(_xprs, static_cast<int>(values.size()),
+                             values.data(), mindex.data(), nullptr);
+  zero_status_check(status, "add MIP start", LOGLOCATION);
+}
+
 /*************************************************************************************************
 -------------------------    Methods to get solutions information
 -----------------------------
@@ -594,6 +629,19 @@ void SolverXpress::set_optimality_gap(double gap) {
   zero_status_check(status, "set optimality gap", LOGLOCATION);
 }
 
+void SolverXpress::set_mip_relative_gap(double gap) {
+  int status = gap < 0 ? XPRSsetdefaultcontrol(_xprs, XPRS_MIPRELSTOP)
+                       : XPRSsetdblcontrol(_xprs, XPRS_MIPRELSTOP, gap);
+  zero_status_check(status, "set mip relative gap", LOGLOCATION);
+}
+
+void SolverXpress::set_dual_tolerance(double tolerance) {
+  int status = tolerance < 0
+                   ? XPRSsetdefaultcontrol(_xprs, XPRS_OPTIMALITYTOL)
+                   : XPRSsetdblcontrol(_xprs, XPRS_OPTIMALITYTOL, tolerance);
+  zero_status_check(status, "set dual tolerance", LOGLOCATION);
+}
+
 void SolverXpress::set_simplex_iter(int iter) {
   int status = XPRSsetdblcontrol(_xprs, XPRS_BARITERLIMIT, iter);
   zero_status_check(status, "set barrier max iter", LOGLOCATION);
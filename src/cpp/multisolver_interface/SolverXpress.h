@@ -120,6 +120,7 @@ class SolverXpress : public SolverAbstract {
   *************************************************************************************************/
  public:
   virtual void del_rows(int first, int last) override;
+  virtual void del_cols(int first, int last) override;
   virtual void add_rows(int newrows, int newnz, const char *qrtype,
                         const double *rhs, const double *range,
                         const int *mstart, const int *mclind,
@@ -152,6 +153,8 @@ class SolverXpress : public SolverAbstract {
  public:
   virtual int solve_lp() override;
   virtual int solve_mip() override;
+  void set_mip_start(const std::vector<int> &mindex,
+                     const std::vector<double> &values) override;
 
   /*************************************************************************************************
   -------------------------    Methods to get solutions information
@@ -191,6 +194,8 @@ class SolverXpress : public SolverAbstract {
   virtual void set_algorithm(std::string const &algo) override;
   virtual void set_threads(int n_threads) override;
   virtual void set_optimality_gap(double gap) override;
+  virtual void set_mip_relative_gap(double gap) override;
+  virtual void set_dual_tolerance(double tolerance) override;
   virtual void set_simplex_iter(int iter) override;
 
  public:
@@ -93,10 +93,15 @@ std::function<int(XPRSprob prob, double ub[], int first, int last)> XPRSgetub =
     nullptr;
 std::function<int(XPRSprob prob, int nrows, const int rowind[])> XPRSdelrows =
     nullptr;
+std::function<int(XPRSprob prob, int ncols, const int colind[])> XPRSdelcols =
+    nullptr;
 std::function<int(XPRSprob prob, int nrows, int ncoefs, const char rowtype[],
                   const double rhs[], const double rng[], const int start[],
                   const int colind[], const double rowcoef[])>
     XPRSaddrows = nullptr;
+std::function<int(XPRSprob prob, int length, const double solval[],
+                  const int colind[], const char* name)>
+    XPRSaddmipsol = nullptr;
 std::function<int(XPRSprob prob, int ncols, int ncoefs, const double objcoef[],
                   const int start[], const int rowind[], const double rowcoef[],
                   const double lb[], const double ub[])>
@@ -143,6 +148,7 @@ std::function<int(XPRSprob prob, int control, int value)> XPRSsetintcontrol =
     nullptr;
 std::function<int(XPRSprob prob, int control, double value)> XPRSsetdblcontrol =
     nullptr;
+std::function<int(XPRSprob prob, int control)> XPRSsetdefaultcontrol = nullptr;
 std::function<int(char* banner)> XPRSgetbanner = nullptr;
 
 std::function<int(char* buffer, int maxbytes)> XPRSgetlicerrmsg = nullptr;
@@ -194,9 +200,11 @@ bool XpressLoader::LoadXpressFunctions(Solver::DynamicLibrary* xpress_dynamic_li
   xpress_dynamic_library->GetFunction(&XPRSgetlb, "XPRSgetlb");
   xpress_dynamic_library->GetFunction(&XPRSgetub, "XPRSgetub");
   xpress_dynamic_library->GetFunction(&XPRSdelrows, "XPRSdelrows");
+  xpress_dynamic_library->GetFunction(&XPRSdelcols, "XPRSdelcols");
   xpress_dynamic_library->GetFunction(&XPRSaddrows, "XPRSaddrows");
   xpress_dynamic_library->GetFunction(&XPRSchgobj, "XPRSchgobj");
   xpress_dynamic_library->GetFunction(&XPRSaddcols, "XPRSaddcols");
+  xpress_dynamic_library->GetFunction(&XPRSaddmipsol, "XPRSaddmipsol");
   xpress_dynamic_library->GetFunction(&XPRSchgobjsense, "XPRSchgobjsense");
   xpress_dynamic_library->GetFunction(&XPRSchgbounds, "XPRSchgbounds");
   xpress_dynamic_library->GetFunction(&XPRSchgcoltype, "XPRSchgcoltype");
@@ -210,6 +218,8 @@ bool XpressLoader::LoadXpressFunctions(Solver::DynamicLibrary* xpress_dynamic_li
   xpress_dynamic_library->GetFunction(&XPRSaddcbmessage, "XPRSaddcbmessage");
   xpress_dynamic_library->GetFunction(&XPRSsetintcontrol, "XPRSsetintcontrol");
   xpress_dynamic_library->GetFunction(&XPRSsetdblcontrol, "XPRSsetdblcontrol");
+  xpress_dynamic_library->GetFunction(&XPRSsetdefaultcontrol,
+                                      "XPRSsetdefaultcontrol");
   xpress_dynamic_library->GetFunction(&XPRSgetbanner, "XPRSgetbanner");
   xpress_dynamic_library->GetFunction(&XPRSgetlicerrmsg, "XPRSgetlicerrmsg");
   xpress_dynamic_library->GetFunction(&XPRSlicense, "XPRSlicense");
@@ -0,0 +1,124 @@
+#pragma once
+
+#include <cstdio>
+#include <filesystem>
+#include <memory>
+#include <string>
+
+/* Compression of problem files, chosen from the file extension on writing
+ * and from the file content on reading */
+enum class FileCompression { NONE, GZIP, ZSTD };
+
+/**
+ * @brief compression matching the extension of filename (.gz, .zst)
+ */
+FileCompression compression_from_extension(
+    const std::filesystem::path &filename);
+
+/**
+ * @brief compression named by an option value (none, gzip, zstd)
+ */
+FileCompression compression_from_name(const std::string &name);
+
+/**
+ * @brief extension to append to a file name written with compression
+ */
+std::string compression_extension(FileCompression compression);
+
+/**
+ * @brief compression of an existing file, detected from its magic number
+ */
+FileCompression detect_compression(const std::filesystem::path &filename);
+
+/**
+ * @brief returns filename if it exists, otherwise its existing compressed
+ * counterpart (filename.gz, filename.zst, or with a .mps extension when
+ * filename has none). Returns filename unchanged if none exists.
+ */
+std::filesystem::path find_problem_file(const std::filesystem::path &filename);
+
+/**
+ * @brief writes the decompressed content of source in destination
+ */
+void decompress_file(const std::filesystem::path &source,
+                     const std::filesystem::path &destination);
+
+/**
+ * @brief writes the content of source in destination with compression
+ */
+void compress_file(const std::filesystem::path &source,
+                   const std::filesystem::path &destination,
+                   FileCompression compression);
+
+/*!
+ * \class class CompressedOutputFile
+ * \brief Output file compressing everything written to it on the fly
+ */
+class CompressedOutputFile {
+ public:
+  CompressedOutputFile();
+  CompressedOutputFile(const CompressedOutputFile &) = delete;
+  CompressedOutputFile &operator=(const CompressedOutputFile &) = delete;
+  ~CompressedOutputFile();
+
+  void open(const std::filesystem::path &filename,
+            FileCompression compression);
+  void write(const char *data, std::size_t size);
+  /**
+   * @brief flushes the compression stream and closes the file
+   */
+  void close();
+
+  class Encoder;
+
+ private:
+  std::FILE *file_ = nullptr;
+  std::unique_ptr<Encoder> encoder_;
+  std::filesystem::path filename_;
+};
+
+/*!
+ * \class class TemporaryProblemFile
+ * \brief Empty file created under a unique name in the temporary directory,
+ * removed with the object
+ */
+class TemporaryProblemFile {
+ public:
+  /**
+   * @brief creates the file, its name ending with extension (e.g. ".mps")
+   */
+  explicit TemporaryProblemFile(const std::string &extension);
+  TemporaryProblemFile(const TemporaryProblemFile &) = delete;
+  TemporaryProblemFile &operator=(const TemporaryProblemFile &) = delete;
+  ~TemporaryProblemFile();
+
+  [[nodiscard]] const std::filesystem::path &path() const { return path_; }
+
+ private:
+  std::filesystem::path path_;
+};
+
+/*!
+ * \class class DecompressedProblemFile
+ * \brief Streams the decompression of a problem file into an anonymous
+ * in-memory file, readable by the backends through path() as long as the
+ * object lives. No temporary file is created on disk on linux, other systems
+ * use a TemporaryProblemFile.
+ */
+class DecompressedProblemFile {
+ public:
+  explicit DecompressedProblemFile(const std::filesystem::path &filename);
+  DecompressedProblemFile(const DecompressedProblemFile &) = delete;
+  DecompressedProblemFile &operator=(const DecompressedProblemFile &) = delete;
+  ~DecompressedProblemFile();
+
+  [[nodiscard]] const std::filesystem::path &path() const { return path_; }
+
+ private:
+  void append(const char *data, std::size_t size);
+
+  int fd_ = -1;
+  std::unique_ptr<TemporaryProblemFile> temporary_file_;
+  std::filesystem::path path_;
+  std::filesystem::path filename_;
+};
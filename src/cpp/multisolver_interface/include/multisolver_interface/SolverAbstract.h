@@ -2,6 +2,7 @@
 
 #include <cstdio>
 #include <filesystem>
+#include <functional>
 #include <iomanip>
 #include <iostream>
 #include <list>
@@ -12,6 +13,7 @@
 #include <vector>
 
 #include "LogUtils.h"
+#include "multisolver_interface/SparseMatrixView.h"
 
 class SolverLogManager {
  public:
@@ -163,6 +165,23 @@ enum SOLVER_STATUS {
   UNKNOWN,
 };
 
+/**
+ * @brief row given by a lazy constraint callback:
+ * sum of values[k] * x[indexes[k]] <= rhs
+ */
+struct LazyConstraint {
+  std::vector<int> indexes;
+  std::vector<double> values;
+  double rhs = 0;
+};
+
+/**
+ * @brief called with the value of every column at an integer solution of the
+ * branch and bound, returns the rows this solution has to satisfy
+ */
+using LazyConstraintCallback =
+    std::function<std::vector<LazyConstraint>(const std::vector<double> &)>;
+
 /*!
  * \class class SolverAbstract
  * \brief Virtual class to implement solvers methods
@@ -445,6 +464,71 @@ class SolverAbstract {
    */
   virtual void get_ub(double *ub, int fisrt, int last) const = 0;
 
+  /**
+   * @brief Returns the matrix stored row by row, without copy when the solver
+   * exposes it. Any change of the problem invalidates the view.
+   */
+  virtual SparseMatrixView get_rows_view() const {
+    const int nrows = get_nrows();
+    const int nelems = get_nelems();
+    std::vector<int> mstart(nrows + 1, 0);
+    std::vector<int> mclind(nelems);
+    std::vector<double> dmatval(nelems);
+    int nels = 0;
+    if (nrows > 0) {
+      get_rows(mstart.data(), mclind.data(), dmatval.data(), nelems, &nels, 0,
+               nrows - 1);
+    }
+    mclind.resize(nels);
+    dmatval.resize(nels);
+    return {ArrayView<int>(std::move(mstart)), ArrayView<int>(std::move(mclind)),
+            ArrayView<double>(std::move(dmatval))};
+  }
+
+  /**
+   * @brief Returns the matrix stored column by column, without copy when the
+   * solver exposes it. Any change of the problem invalidates the view.
+   */
+  virtual SparseMatrixView get_cols_view() const {
+    return TransposedMatrix(get_rows_view(), get_ncols());
+  }
+
+  /**
+   * @brief Returns the objective function coefficients of all the columns,
+   * without copy when the solver exposes them
+   */
+  virtual ArrayView<double> get_obj_view() const {
+    std::vector<double> obj(get_ncols());
+    if (!obj.empty()) {
+      get_obj(obj.data(), 0, static_cast<int>(obj.size()) - 1);
+    }
+    return ArrayView<double>(std::move(obj));
+  }
+
+  /**
+   * @brief Returns the lower bounds of all the columns, without copy when the
+   * solver exposes them
+   */
+  virtual ArrayView<double> get_lb_view() const {
+    std::vector<double> lb(get_ncols());
+    if (!lb.empty()) {
+      get_lb(lb.data(), 0, static_cast<int>(lb.size()) - 1);
+    }
+    return ArrayView<double>(std::move(lb));
+  }
+
+  /**
+   * @brief Returns the upper bounds of all the columns, without copy when the
+   * solver exposes them
+   */
+  virtual ArrayView<double> get_ub_view() const {
+    std::vector<double> ub(get_ncols());
+    if (!ub.empty()) {
+      get_ub(ub.data(), 0, static_cast<int>(ub.size()) - 1);
+    }
+    return ArrayView<double>(std::move(ub));
+  }
+
   /**
    * @brief Returns the index of row named "name"
    *
@@ -504,6 +588,14 @@ class SolverAbstract {
    */
   virtual void del_rows(int first, int last) = 0;
 
+  /**
+   * @brief Deletes columns between index first and last
+   *
+   * @param first  : first column index to delete
+   * @param last   : last column index to delete
+   */
+  virtual void del_cols(int first, int last) = 0;
+
   /**
   * @brief Adds rows to the problem
   *
@@ -656,6 +748,17 @@ class SolverAbstract {
    */
   virtual int solve_mip() = 0;
 
+  /**
+   * @brief Gives a solution, possibly partial, for the next MIP solve to start
+   * from. The columns not given are computed by the solver, which drops the
+   * solution if it cannot be made feasible.
+   *
+   * @param mindex : indices of the given columns
+   * @param values : values of the given columns
+   */
+  virtual void set_mip_start(const std::vector<int> &mindex,
+                             const std::vector<double> &values) = 0;
+
   /*************************************************************************************************
   -------------------------    Methods to get solutions information
   -----------------------------
@@ -749,6 +852,39 @@ class SolverAbstract {
    */
   virtual void set_optimality_gap(double gap) = 0;
 
+  /**
+   * @brief Sets the relative gap at which the branch and bound of solve_mip
+   * stops, kept for the next solves. Ignored by the LP only solvers.
+   *
+   * @param gap: relative gap between the best bound and the incumbent, a
+   * negative one for the solver's default
+   */
+  virtual void set_mip_relative_gap(double gap) = 0;
+
+  /**
+   * @brief Sets the tolerance on the reduced costs at which the simplex
+   * declares optimality, kept for the next solves
+   *
+   * @param tolerance: largest reduced cost of the wrong sign accepted, a
+   * negative one for the solver's default
+   */
+  virtual void set_dual_tolerance(double tolerance) = 0;
+
+  /**
+   * @brief Sets the function called at each integer solution found by the
+   * branch and bound of solve_mip. The rows it returns are added to the tree
+   * as globally valid cuts: the solution is only accepted when it satisfies
+   * them. They are not added to the problem. Kept for the next solves, an
+   * empty callback removes it.
+   *
+   * @param callback: rows to add at an integer solution, none to accept it
+   */
+  virtual void set_lazy_constraint_callback(LazyConstraintCallback callback) {
+    throw NotImplementedFeatureSolverException(
+        LOGLOCATION + "Lazy constraints not supported by solver " +
+        get_solver_name());
+  }
+
   /**
    * @brief Sets the maximum number of simplex iterations the solver can perform
    *
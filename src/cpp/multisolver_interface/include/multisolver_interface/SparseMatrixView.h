@@ -0,0 +1,96 @@
+#pragma once
+
+#include <span>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief read-only array returned by the solvers: a span on the solver's own
+ * storage when it can be exposed, or on a buffer owned by the view otherwise.
+ * A borrowed view is invalidated by any change of the problem.
+ */
+template <class T>
+class ArrayView {
+ public:
+  ArrayView() = default;
+  explicit ArrayView(std::span<const T> borrowed) : view_(borrowed) {}
+  explicit ArrayView(std::vector<T> owned)
+      : owned_(std::move(owned)), view_(owned_) {}
+
+  // moving the buffer keeps its address, copying it would not
+  ArrayView(const ArrayView &) = delete;
+  ArrayView &operator=(const ArrayView &) = delete;
+  ArrayView(ArrayView &&) noexcept = default;
+  ArrayView &operator=(ArrayView &&) noexcept = default;
+
+  [[nodiscard]] std::span<const T> span() const { return view_; }
+  [[nodiscard]] const T *data() const { return view_.data(); }
+  [[nodiscard]] size_t size() const { return view_.size(); }
+  [[nodiscard]] bool empty() const { return view_.empty(); }
+  const T &operator[](size_t index) const { return view_[index]; }
+  [[nodiscard]] auto begin() const { return view_.begin(); }
+  [[nodiscard]] auto end() const { return view_.end(); }
+
+  /**
+   * @brief true when the data is read from the solver without copy
+   */
+  [[nodiscard]] bool borrowed() const {
+    return owned_.empty() && !view_.empty();
+  }
+
+ private:
+  std::vector<T> owned_;
+  std::span<const T> view_;
+};
+
+/**
+ * @brief compressed sparse matrix, stored row by row (CSR) or column by column
+ * (CSC): the elements of vector i are indexes[k], values[k] for k in
+ * [starts[i], starts[i + 1])
+ */
+struct SparseMatrixView {
+  ArrayView<int> starts;
+  ArrayView<int> indexes;
+  ArrayView<double> values;
+
+  [[nodiscard]] int number_of_vectors() const {
+    return starts.empty() ? 0 : static_cast<int>(starts.size()) - 1;
+  }
+  [[nodiscard]] int number_of_elements() const {
+    return starts.empty() ? 0 : starts[starts.size() - 1] - starts[0];
+  }
+};
+
+/**
+ * @brief CSC copy of a CSR matrix, or the other way round
+ *
+ * @param matrix           : matrix to transpose
+ * @param minor_dimension  : number of columns of a CSR matrix, number of rows
+ * of a CSC one
+ */
+inline SparseMatrixView TransposedMatrix(const SparseMatrixView &matrix,
+                                         int minor_dimension) {
+  const int major_dimension = matrix.number_of_vectors();
+  std::vector<int> starts(minor_dimension + 1, 0);
+  for (int major(0); major < major_dimension; ++major) {
+    for (int k = matrix.starts[major]; k < matrix.starts[major + 1]; ++k) {
+      ++starts[matrix.indexes[k] + 1];
+    }
+  }
+  for (int minor(0); minor < minor_dimension; ++minor) {
+    starts[minor + 1] += starts[minor];
+  }
+
+  std::vector<int> indexes(starts.back());
+  std::vector<double> values(starts.back());
+  std::vector<int> next(starts.begin(), starts.end() - 1);
+  for (int major(0); major < major_dimension; ++major) {
+    for (int k = matrix.starts[major]; k < matrix.starts[major + 1]; ++k) {
+      const int position = next[matrix.indexes[k]]++;
+      indexes[position] = major;
+      values[position] = matrix.values[k];
+    }
+  }
+  return {ArrayView<int>(std::move(starts)), ArrayView<int>(std::move(indexes)),
+          ArrayView<double>(std::move(values))};
+}
@@ -1,9 +1,13 @@
+#include <algorithm>
 #include <numeric>
 
 #include "BatchCollection.h"
+#include "BatchPriorityScheduler.h"
 #include "BendersByBatch.h"
 #include "LogPrefixManip.h"
+#include "LoggerStub.h"
 #include "RandomBatchShuffler.h"
+#include "RandomDirGenerator.h"
 #include "gtest/gtest.h"
 #include "logger/Master.h"
 #include "logger/User.h"
@@ -103,6 +107,84 @@ TEST_F(BatchCollectionTest,
   ASSERT_EQ(expected_vec_batch2_names, vec_batch2);
 }
 
+TEST_F(BatchCollectionTest, BatchesAreReplacedWhenRebuiltWithAnotherSize) {
+  auto batch_collection = BatchCollection(sub_problems_name_list_5, 2, logger_);
+  batch_collection.BuildBatches();
+  batch_collection.SetBatchSize(4);
+  batch_collection.BuildBatches();
+
+  ASSERT_EQ(batch_collection.NumberOfBatch(), 2);
+  ASSERT_EQ(batch_collection.size(), 2);
+  const std::vector<std::string> expected_vec_batch1_names = {"P5"};
+  ASSERT_EQ(batch_collection.GetBatchFromId(1).sub_problem_names,
+            expected_vec_batch1_names);
+}
+
+TEST_F(BatchCollectionTest, StratifiedBatchesSpreadOverWeeksAndYears) {
+  const std::vector<std::string> names = {
+      "problem-1-1", "problem-1-2", "problem-1-3", "problem-1-4",
+      "problem-2-1", "problem-2-2", "problem-2-3", "problem-2-4"};
+  auto batch_collection = BatchCollection(names, 2, logger_);
+  batch_collection.SetConstruction(BatchConstruction::STRATIFIED);
+  batch_collection.BuildBatches();
+
+  ASSERT_EQ(batch_collection.NumberOfBatch(), 4);
+  const std::vector<std::string> expected_vec_batch0_names = {"problem-1-1",
+                                                              "problem-1-3"};
+  const std::vector<std::string> expected_vec_batch1_names = {"problem-2-1",
+                                                              "problem-2-3"};
+  ASSERT_EQ(batch_collection.GetBatchFromId(0).sub_problem_names,
+            expected_vec_batch0_names);
+  ASSERT_EQ(batch_collection.GetBatchFromId(1).sub_problem_names,
+            expected_vec_batch1_names);
+}
+
+TEST_F(BatchCollectionTest, StratifiedBatchesHoldEverySubproblemOnce) {
+  std::vector<std::string> names;
+  for (int year(1); year <= 3; ++year) {
+    for (int week(1); week <= 10; ++week) {
+      names.push_back("problem-" + std::to_string(year) + "-" +
+                      std::to_string(week) + "--optim-nb-1.mps");
+    }
+  }
+  auto batch_collection = BatchCollection(names, 7, logger_);
+  batch_collection.SetConstruction(BatchConstruction::STRATIFIED);
+  batch_collection.BuildBatches();
+
+  ASSERT_EQ(batch_collection.NumberOfBatch(), 5);
+  std::vector<std::string> all_names;
+  for (const auto& batch : batch_collection.BatchCollections()) {
+    ASSERT_LE(batch.sub_problem_names.size(), 7);
+    all_names.insert(all_names.end(), batch.sub_problem_names.begin(),
+                     batch.sub_problem_names.end());
+  }
+  std::sort(all_names.begin(), all_names.end());
+  std::sort(names.begin(), names.end());
+  ASSERT_EQ(all_names, names);
+}
+
+TEST(AdaptiveBatchSizeTest, BatchSizeGrowsAfterMisprices) {
+  ASSERT_EQ(AdaptiveBatchSize(4, 1, 100, 0.5, 1, 25), 8);
+}
+
+TEST(AdaptiveBatchSizeTest, BatchSizeGrowsWhenMostBatchesAreSolved) {
+  ASSERT_EQ(AdaptiveBatchSize(4, 1, 100, 0, 13, 25), 8);
+}
+
+TEST(AdaptiveBatchSizeTest, BatchSizeShrinksWhenTheFirstBatchIsEnough) {
+  ASSERT_EQ(AdaptiveBatchSize(4, 1, 100, 0, 1, 25), 2);
+}
+
+TEST(AdaptiveBatchSizeTest, BatchSizeIsKeptOtherwise) {
+  ASSERT_EQ(AdaptiveBatchSize(4, 1, 100, 0.25, 3, 25), 4);
+}
+
+TEST(AdaptiveBatchSizeTest, BatchSizeStaysWithinItsBounds) {
+  ASSERT_EQ(AdaptiveBatchSize(64, 1, 100, 1, 2, 2), 100);
+  ASSERT_EQ(AdaptiveBatchSize(5, 4, 100, 0, 1, 20), 4);
+  ASSERT_EQ(AdaptiveBatchSize(2, 4, 3, 0, 1, 2), 3);
+}
+
 class RandomBatchShufflerTest : public ::testing::Test {};
 
 TEST_F(RandomBatchShufflerTest, GetCyclicBatchPermutation) {
@@ -112,4 +194,133 @@ TEST_F(RandomBatchShufflerTest, GetCyclicBatchPermutation) {
   std::vector<unsigned> expected_vec = {5, 6, 7, 8, 9, 0, 1, 2, 3, 4};
 
   ASSERT_TRUE(expected_vec == random_batch_permutation);
-}
\ No newline at end of file
+}
+
+TEST(BatchPrioritySchedulerTest, NeverSolvedBatchesComeFirstInCyclicOrder) {
+  auto scheduler = BatchPriorityScheduler(4);
+  scheduler.Record(1, 10, 1);
+  const std::vector<unsigned> expected_vec = {2, 3, 0, 1};
+
+  ASSERT_EQ(scheduler.GetBatchOrder(2, 2), expected_vec);
+}
+
+TEST(BatchPrioritySchedulerTest, BatchesAreOrderedByDecreasingViolation) {
+  auto scheduler = BatchPriorityScheduler(4);
+  scheduler.Record(0, 1, 1);
+  scheduler.Record(1, 5, 2);
+  scheduler.Record(2, 0, 3);
+  scheduler.Record(3, 5, 4);
+  const std::vector<unsigned> expected_vec = {3, 1, 0, 2};
+
+  ASSERT_EQ(scheduler.GetBatchOrder(3, 4), expected_vec);
+}
+
+TEST(BatchPrioritySchedulerTest, StaleBatchesAreSolvedAgainFirst) {
+  auto scheduler = BatchPriorityScheduler(3);
+  scheduler.Record(0, 0, 1);
+  scheduler.Record(1, 5, 3);
+  scheduler.Record(2, 8, 4);
+  const std::vector<unsigned> expected_vec = {0, 2, 1};
+
+  ASSERT_EQ(scheduler.GetBatchOrder(0, 4), expected_vec);
+}
+
+TEST(BatchPrioritySchedulerTest, EveryBatchIsInTheOrder) {
+  auto scheduler = BatchPriorityScheduler(5);
+  scheduler.Record(4, 3, 1);
+  scheduler.Record(1, 7, 2);
+  auto order = scheduler.GetBatchOrder(1, 3);
+  std::sort(order.begin(), order.end());
+  const std::vector<unsigned> expected_vec = {0, 1, 2, 3, 4};
+
+  ASSERT_EQ(order, expected_vec);
+}
+
+TEST(BatchPrioritySchedulerTest, ViolationsAreForgottenAfterReset) {
+  auto scheduler = BatchPriorityScheduler(3);
+  scheduler.Record(2, 3, 1);
+  scheduler.Reset(2);
+  const std::vector<unsigned> expected_vec = {1, 0};
+
+  ASSERT_EQ(scheduler.GetBatchOrder(1, 2), expected_vec);
+}
+
+class BendersByBatchLevelDouble : public BendersByBatch {
+ public:
+  using BendersByBatch::BendersByBatch;
+
+  void BuildMaster(VariableMap variables) {
+    master_variable_map_ = std::move(variables);
+    reset_master<WorkerMaster>(master_variable_map_, get_master_path(),
+                               get_solver_name(), get_log_level(),
+                               _data.nsubproblem, solver_log_manager_,
+                               IsResumeMode(), _logger,
+                               MasterSubproblemClusters());
+  }
+  void ProjectOnLevel(const Point& center, const Point& x_cut, double lb) {
+    _data.it = 2;
+    _data.x_in = center;
+    _data.x_cut = x_cut;
+    _data.lb = lb;
+    ComputeLevelPoint();
+  }
+  CurrentIterationData NextXCut() {
+    ComputeXCut();
+    return _data;
+  }
+  [[nodiscard]] const CurrentIterationData& Data() const { return _data; }
+  using BendersBase::LevelPointGap;
+};
+
+TEST(BendersByBatchLevelTest, LevelPointIsEvaluatedAsIs) {
+  // a single process environment, kept until the end of the tests
+  static mpi::environment env;
+  mpi::communicator world;
+  const auto input_root =
+      CreateRandomSubDir(std::filesystem::temp_directory_path());
+  std::filesystem::copy(
+      std::filesystem::path("data_test") / "mps" / "mip_toy_prob.mps",
+      input_root);
+  BaseOptions base_options;
+  base_options.LOG_LEVEL = 0;
+  base_options.OUTPUTROOT = "my_output";
+  base_options.SLAVE_WEIGHT = "CONSTANT";
+  base_options.SLAVE_WEIGHT_VALUE = 1;
+  base_options.MASTER_NAME = "mip_toy_prob";
+  base_options.STRUCTURE_FILE = "my_structure.txt";
+  base_options.INPUTROOT = input_root.string();
+  base_options.SOLVER_NAME = "COIN";
+  BendersBaseOptions options(base_options);
+  options.SEPARATION_PARAM = 0.7;
+  options.MASTER_STABILIZATION = MasterStabilization::LEVEL_BUNDLE;
+  options.LEVEL_BUNDLE_PARAM = 0.5;
+  BendersByBatchLevelDouble benders(options,
+                                    std::make_shared<LoggerNOOPStub>(),
+                                    nullptr, env, world, nullptr);
+  benders.BuildMaster({{"x1", 0}, {"x2", 1}});
+  const auto& solver = benders.get_master()->solver();
+  const int ncols = solver->get_ncols();
+  const int nrows = solver->get_nrows();
+  const auto obj_view = solver->get_obj_view();
+  const std::vector<double> obj(obj_view.begin(), obj_view.end());
+
+  // the upper bound estimate is the investment cost at x_cut, -13: the level
+  // is -18, whose closest integer point to the origin is (2, 2)
+  const Point x_cut = {{"x1", 1}, {"x2", 2}};
+  benders.ProjectOnLevel({{"x1", 0}, {"x2", 0}}, x_cut, -23);
+
+  const auto x_out = benders.Data().x_out;
+  EXPECT_NEAR(x_out.at("x1"), 2, 1e-6);
+  EXPECT_NEAR(x_out.at("x2"), 2, 1e-6);
+  EXPECT_NEAR(benders.LevelPointGap(), 5, 1e-6);
+  EXPECT_EQ(benders.Data().lb, -23);
+  EXPECT_EQ(solver->get_ncols(), ncols);
+  EXPECT_EQ(solver->get_nrows(), nrows);
+  const auto restored_obj = solver->get_obj_view();
+  EXPECT_EQ(std::vector<double>(restored_obj.begin(), restored_obj.end()),
+            obj);
+
+  const auto data = benders.NextXCut();
+  EXPECT_EQ(data.x_cut, x_out);
+  EXPECT_EQ(data.x_in, x_cut);
+}
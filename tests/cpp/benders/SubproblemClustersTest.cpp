@@ -0,0 +1,198 @@
+#include <algorithm>
+#include <set>
+
+#include "BendersSequential.h"
+#include "LoggerStub.h"
+#include "SubproblemClusters.h"
+#include "WorkerMaster.h"
+#include "gtest/gtest.h"
+
+TEST(SubproblemClustersTest, SubproblemsAreOrderedByWeekThenYear) {
+  const std::vector<std::string> names = {"problem-2-1", "problem-1-2",
+                                          "problem-1-1", "problem-2-2"};
+  EXPECT_EQ(OrderSubproblems(names, SubproblemClustering::WEEK),
+            std::vector<int>({2, 0, 1, 3}));
+}
+
+TEST(SubproblemClustersTest, SubproblemsAreClusteredByYear) {
+  const std::vector<std::string> names = {"problem-2-1", "problem-1-2",
+                                          "problem-1-1", "problem-2-2"};
+  const auto clusters =
+      ClusterSubproblems(names, 2, SubproblemClustering::YEAR);
+  EXPECT_EQ(clusters, std::vector<int>({1, 0, 0, 1}));
+}
+
+TEST(SubproblemClustersTest, SubproblemsAreClusteredByWeek) {
+  const std::vector<std::string> names = {"problem-2-1", "problem-1-2",
+                                          "problem-1-1", "problem-2-2"};
+  const auto clusters =
+      ClusterSubproblems(names, 2, SubproblemClustering::WEEK);
+  EXPECT_EQ(clusters, std::vector<int>({0, 1, 0, 1}));
+}
+
+TEST(SubproblemClustersTest, YearsAndWeeksAreComparedAsNumbers) {
+  const std::vector<std::string> names = {"problem-10-1--optim-nb-1.mps",
+                                          "problem-9-1--optim-nb-1.mps",
+                                          "problem-1-1--optim-nb-1.mps"};
+  const auto clusters =
+      ClusterSubproblems(names, 3, SubproblemClustering::YEAR);
+  EXPECT_EQ(clusters, std::vector<int>({2, 1, 0}));
+}
+
+TEST(SubproblemClustersTest, ClustersSizesDifferByAtMostOne) {
+  std::vector<std::string> names;
+  for (int year(1); year <= 7; ++year) {
+    names.push_back("problem-" + std::to_string(year) + "-1");
+  }
+  const auto clusters =
+      ClusterSubproblems(names, 3, SubproblemClustering::YEAR);
+  std::vector<int> sizes(3, 0);
+  for (const auto cluster : clusters) {
+    ASSERT_GE(cluster, 0);
+    ASSERT_LT(cluster, 3);
+    ++sizes[cluster];
+  }
+  EXPECT_LE(*std::max_element(sizes.begin(), sizes.end()) -
+                *std::min_element(sizes.begin(), sizes.end()),
+            1);
+}
+
+TEST(SubproblemClustersTest, OtherNamesComeLast) {
+  const std::vector<std::string> names = {"P1", "problem-1-1", "P2",
+                                          "problem-2-1"};
+  const auto clusters =
+      ClusterSubproblems(names, 4, SubproblemClustering::YEAR);
+  EXPECT_EQ(clusters, std::vector<int>({2, 0, 3, 1}));
+}
+
+TEST(SubproblemClustersTest, NumberOfClustersIsBoundedBySubproblems) {
+  const std::vector<std::string> names = {"problem-1-1", "problem-2-1"};
+  EXPECT_EQ(ClusterSubproblems(names, 5, SubproblemClustering::YEAR),
+            std::vector<int>({0, 1}));
+  EXPECT_EQ(ClusterSubproblems(names, 0, SubproblemClustering::YEAR),
+            std::vector<int>({0, 0}));
+}
+
+TEST(SubproblemClustersTest, MasterHasOneAlphaPerCluster) {
+  const auto mps = std::filesystem::path("data_test") / "mps" /
+                   "mip_toy_prob.mps";
+  Logger logger = std::make_shared<LoggerNOOPStub>();
+  SolverLogManager solver_log_manager;
+
+  WorkerMaster master_by_subproblem({}, mps, "COIN", 0, 4, solver_log_manager,
+                                    false, logger);
+  WorkerMaster master_by_cluster({}, mps, "COIN", 0, 4, solver_log_manager,
+                                 false, logger, {0, 1, 0, 1});
+
+  EXPECT_EQ(master_by_subproblem._solver->get_ncols() -
+                master_by_cluster._solver->get_ncols(),
+            2);
+  const auto names = master_by_cluster._solver->get_col_names();
+  EXPECT_NE(std::find(names.begin(), names.end(), "alpha_cluster_0"),
+            names.end());
+  EXPECT_NE(std::find(names.begin(), names.end(), "alpha_cluster_1"),
+            names.end());
+}
+
+class BendersByClusterDouble : public BendersSequential {
+ public:
+  BendersByClusterDouble(BendersBaseOptions const &options, Logger logger)
+      : BendersSequential(options, std::move(logger), nullptr, nullptr) {}
+
+  void InitializeMaster(CouplingMap coupling_map, VariableMap variables,
+                        std::filesystem::path const &mps) {
+    coupling_map_ = std::move(coupling_map);
+    master_variable_map_ = std::move(variables);
+    MatchProblemToId();
+    init_data();
+    _data.nsubproblem = static_cast<int>(coupling_map_.size());
+    _data.master_status = SOLVER_STATUS::OPTIMAL;
+    SetAlpha_i(DblVector(_data.nsubproblem, 0));
+    reset_master<WorkerMaster>(master_variable_map_, mps, get_solver_name(),
+                               get_log_level(), _data.nsubproblem,
+                               solver_log_manager_, false, _logger,
+                               MasterSubproblemClusters());
+  }
+  using BendersBase::BuildCutFull;
+  using BendersBase::get_master;
+  using BendersBase::MasterRowsFrom;
+  using BendersBase::set_x_cut;
+  using BendersBase::set_x_out;
+};
+
+TEST(SubproblemClustersTest, OneAggregatedCutIsAddedPerCluster) {
+  BaseOptions base_options;
+  base_options.SOLVER_NAME = "COIN";
+  BendersBaseOptions options(base_options);
+  options.MASTER_FORMULATION = MasterFormulation::INTEGER;
+  options.CUT_CLUSTERS = 2;
+  options.CUT_CLUSTERING = SubproblemClustering::WEEK;
+  BendersByClusterDouble benders(options,
+                                 std::make_shared<LoggerNOOPStub>());
+
+  const VariableMap variables = {{"x1", 0}, {"x2", 1}};
+  // clusters {0, 1, 0, 1} by week, in the order of the ids
+  benders.InitializeMaster({{"problem-1-1", variables},
+                            {"problem-1-2", variables},
+                            {"problem-2-1", variables},
+                            {"problem-2-2", variables}},
+                           variables,
+                           std::filesystem::path("data_test") / "mps" /
+                               "mip_toy_prob.mps");
+  const Point x_cut = {{"x1", 1}, {"x2", 2}};
+  benders.set_x_cut(x_cut);
+  benders.set_x_out(x_cut);
+
+  SubProblemDataMap subproblem_data_map;
+  const auto add_subproblem = [&subproblem_data_map](
+                                  std::string const &name, double cost,
+                                  Point const &subgradient) {
+    auto &subproblem_data = subproblem_data_map[name];
+    subproblem_data.subproblem_cost = cost;
+    subproblem_data.var_name_and_subgradient = subgradient;
+    subproblem_data.lpstatus = SOLVER_STATUS::OPTIMAL;
+    subproblem_data.pareto_timer = 0;
+  };
+  add_subproblem("problem-1-1", 10, {{"x1", -1}, {"x2", 0}});
+  add_subproblem("problem-1-2", 4, {{"x1", 0}, {"x2", -2}});
+  add_subproblem("problem-2-1", 6, {{"x1", -3}, {"x2", -1}});
+  add_subproblem("problem-2-2", 8, {{"x2", -1}});
+
+  const auto &solver = benders.get_master()->_solver;
+  const int first_cut = solver->get_nrows();
+  benders.BuildCutFull(subproblem_data_map);
+  const auto cuts = benders.MasterRowsFrom(first_cut);
+  ASSERT_EQ(cuts.size(), 2u);
+
+  // alpha_k >= cost_k + s_k.(x - x_cut), the sums over the subproblems of
+  // cluster k, in the solver as -alpha_k + s_k.x <= -cost_k + s_k.x_cut
+  const std::map<std::string, std::pair<double, Point>> expected_cuts = {
+      {"alpha_cluster_0", {16, {{"x1", -4}, {"x2", -1}}}},
+      {"alpha_cluster_1", {12, {{"x1", 0}, {"x2", -3}}}}};
+  const auto names = solver->get_col_names();
+  std::set<std::string> cut_alphas;
+  for (const auto &cut : cuts) {
+    Point coefficients;
+    for (size_t k(0); k < cut.indexes.size(); ++k) {
+      coefficients[names[cut.indexes[k]]] += cut.values[k];
+    }
+    const auto alpha = std::find_if(
+        coefficients.begin(), coefficients.end(),
+        [](const auto &coefficient) {
+          return coefficient.first.rfind("alpha_cluster_", 0) == 0;
+        });
+    ASSERT_NE(alpha, coefficients.end());
+    EXPECT_DOUBLE_EQ(alpha->second, -1);
+    ASSERT_TRUE(expected_cuts.count(alpha->first));
+    cut_alphas.insert(alpha->first);
+
+    const auto &[cost, subgradient] = expected_cuts.at(alpha->first);
+    double rhs = -cost;
+    for (const auto &[candidate, value] : subgradient) {
+      EXPECT_DOUBLE_EQ(coefficients[candidate], value) << candidate;
+      rhs += value * x_cut.at(candidate);
+    }
+    EXPECT_DOUBLE_EQ(cut.rhs, rhs);
+  }
+  EXPECT_EQ(cut_alphas.size(), 2u);
+}
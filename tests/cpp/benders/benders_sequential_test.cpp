@@ -1,4 +1,5 @@
 #include <algorithm>
+#include <cmath>
 
 #include "ArchiveWriter.h"
 #include "BendersSequential.h"
@@ -98,8 +99,44 @@ class BendersSequentialDouble : public BendersSequential {
     _data.x_out = x_out;
     _data.x_in = x_in;
   }
+  PlainData::SubProblemData SolveParetoCut(
+      const std::shared_ptr<SubproblemWorker> &worker, const Point &x_cut,
+      const Point &x_in) {
+    PlainData::SubProblemData subproblem_data;
+    set_x_cut(x_cut);
+    set_x_in(x_in);
+    SolveSubproblemAtXCut(worker, subproblem_data);
+    worker->get_subgradient(subproblem_data.var_name_and_subgradient);
+    StrengthenSubproblemCut(worker, subproblem_data);
+    return subproblem_data;
+  }
   void set_ub(double ub) { parametrized_ub = ub; }
   void set_it(int it) { parametrized_it = it; }
+  void set_current_bounds(double lb, double best_ub) {
+    _data.lb = lb;
+    _data.best_ub = best_ub;
+  }
+  void set_master_variables(VariableMap variables) {
+    master_variable_map_ = std::move(variables);
+  }
+  void ProjectOnLevel(const Point &center, double lb, double best_ub) {
+    _data.x_in = center;
+    _data.lb = lb;
+    _data.best_ub = best_ub;
+    ComputeLevelPoint();
+  }
+  void NextXCut(const Point &x_out) {
+    _data.it = 2;
+    _data.x_out = x_out;
+    ComputeXCut();
+  }
+  using BendersBase::IsMasterSolvedAtFinalGap;
+  using BendersBase::LevelPointGap;
+  using BendersBase::ShouldBendersStop;
+  using BendersBase::SolveMasterSingleTree;
+  using BendersBase::UpdateMasterRelativeGap;
+  using BendersBase::SubproblemTolerance;
+  using BendersBase::UpdateSubproblemTolerance;
 };
 
 class BendersSequentialTest : public ::testing::Test {
@@ -226,6 +263,20 @@ TEST_F(BendersSequentialTest, MasterRelaxedWhenSepLowerThanOne) {
   EXPECT_EQ(benders._setDataPostRelaxationCall, false);
 }
 
+TEST_F(BendersSequentialTest, MasterNotRelaxedWithLevelBundle) {
+  copyMasterMps();
+  BendersBaseOptions options =
+      init_benders_options(MasterFormulation::INTEGER, 1, 1e-2, 0.7);
+  options.MASTER_STABILIZATION = MasterStabilization::LEVEL_BUNDLE;
+  BendersSequentialDouble benders(options, logger, writer, mathLoggerDriver);
+
+  benders.set_data(true, 0);
+  benders.launch();
+
+  EXPECT_EQ(benders._deactivateIntConstraintCall, false);
+  EXPECT_EQ(benders._setDataPreRelaxationCall, false);
+}
+
 TEST_F(BendersSequentialTest, ReactivateIntConstraintAfterRelaxedGapReached) {
   copyMasterMps();
   MasterFormulation master_formulation = MasterFormulation::INTEGER;
@@ -382,3 +433,256 @@ TEST_F(BendersSequentialTest, CheckInOutDataWhenImprovement) {
   EXPECT_EQ(benders.get_data().best_ub, current_ub);
   EXPECT_EQ(benders.get_data().best_it, current_it + 1);
 }
+
+TEST_F(BendersSequentialTest, AdaptiveSeparationMovesTowardXOutAfterMisprice) {
+  copyMasterMps();
+  double sep_param = 0.8;
+  int current_it = 4;
+  BendersBaseOptions options = init_benders_options(
+      MasterFormulation::RELAXED, current_it + 1, 1e-2, sep_param);
+  options.ADAPTIVE_SEPARATION = true;
+  BendersSequentialDouble benders(options, logger, writer, mathLoggerDriver);
+
+  benders.set_data(false, 0);
+  benders.set_bounds(1000, 1001);
+  benders.set_it(current_it);
+  benders.set_bestx({{"x1", 1}, {"x2", 2}}, {{"x1", 3}, {"x2", 6}});
+  benders.set_ub(2000);
+
+  // no cut is built by the double: the iteration is a misprice
+  benders.launch();
+
+  EXPECT_EQ(benders.get_data().best_it, 0);
+  EXPECT_DOUBLE_EQ(benders.Options().SEPARATION_PARAM, 0.5 * (1 + sep_param));
+}
+
+TEST_F(BendersSequentialTest, AdaptiveSeparationIsResetAfterImprovement) {
+  copyMasterMps();
+  double sep_param = 0.8;
+  int current_it = 4;
+  BendersBaseOptions options = init_benders_options(
+      MasterFormulation::RELAXED, current_it + 1, 1e-2, sep_param);
+  options.ADAPTIVE_SEPARATION = true;
+  BendersSequentialDouble benders(options, logger, writer, mathLoggerDriver);
+
+  benders.set_data(false, 0);
+  benders.set_bounds(1000, 1001);
+  benders.set_it(current_it);
+  benders.set_bestx({{"x1", 1}, {"x2", 2}}, {{"x1", 3}, {"x2", 6}});
+  benders.set_ub(1000.5);
+
+  benders.launch();
+
+  EXPECT_EQ(benders.get_data().best_it, current_it + 1);
+  EXPECT_DOUBLE_EQ(benders.Options().SEPARATION_PARAM, sep_param);
+}
+
+TEST_F(BendersSequentialTest, FixedSeparationIsKeptAfterMisprice) {
+  copyMasterMps();
+  double sep_param = 0.8;
+  int current_it = 4;
+  BendersSequentialDouble benders = init_benders_sequential(
+      MasterFormulation::RELAXED, current_it + 1, 1e-2, sep_param);
+
+  benders.set_data(false, 0);
+  benders.set_bounds(1000, 1001);
+  benders.set_it(current_it);
+  benders.set_bestx({{"x1", 1}, {"x2", 2}}, {{"x1", 3}, {"x2", 6}});
+  benders.set_ub(2000);
+
+  benders.launch();
+
+  EXPECT_DOUBLE_EQ(benders.Options().SEPARATION_PARAM, sep_param);
+}
+
+TEST_F(BendersSequentialTest, MasterGapIsLooseAgainAfterAFailedConfirmation) {
+  copyMasterMps();
+  BendersBaseOptions options =
+      init_benders_options(MasterFormulation::INTEGER, 1, 1e-2, 1);
+  options.MASTER_INITIAL_RELATIVE_GAP = 0.5;
+  BendersSequentialDouble benders(options, logger, writer, mathLoggerDriver);
+  benders.set_data(true, 0);
+  benders.launch();
+
+  benders.set_current_bounds(1000, 2000);
+  benders.UpdateMasterRelativeGap();
+  ASSERT_FALSE(benders.IsMasterSolvedAtFinalGap());
+
+  // converged with a master solved at a loose gap: confirmation required
+  benders.set_current_bounds(1000, 1000.0005);
+  ASSERT_FALSE(benders.ShouldBendersStop());
+  benders.UpdateMasterRelativeGap();
+  ASSERT_TRUE(benders.IsMasterSolvedAtFinalGap());
+
+  // the confirming master lowered the bound below the gap
+  benders.set_current_bounds(900, 1000.0005);
+  ASSERT_FALSE(benders.ShouldBendersStop());
+  benders.UpdateMasterRelativeGap();
+  EXPECT_FALSE(benders.IsMasterSolvedAtFinalGap());
+}
+
+TEST_F(BendersSequentialTest, MasterAtTheRelativeGapDoesNotConfirmConvergence) {
+  copyMasterMps();
+  BendersBaseOptions options =
+      init_benders_options(MasterFormulation::INTEGER, 1, 1e-2, 1);
+  options.MASTER_INITIAL_RELATIVE_GAP = 0.5;
+  BendersSequentialDouble benders(options, logger, writer, mathLoggerDriver);
+  benders.set_data(true, 0);
+  benders.launch();
+
+  // a tenth of the Benders gap is below RELATIVE_GAP: the master is solved at
+  // RELATIVE_GAP, its incumbent value can still be too high by as much
+  benders.set_current_bounds(1000, 1000.002);
+  benders.UpdateMasterRelativeGap();
+  ASSERT_FALSE(benders.IsMasterSolvedAtFinalGap());
+
+  benders.set_current_bounds(1000, 1000.0005);
+  EXPECT_FALSE(benders.ShouldBendersStop());
+  benders.UpdateMasterRelativeGap();
+  EXPECT_TRUE(benders.IsMasterSolvedAtFinalGap());
+}
+
+TEST_F(BendersSequentialTest, SubproblemsAreSolvedAtTheSolverDefaultOnceTight) {
+  copyMasterMps();
+  BendersBaseOptions options =
+      init_benders_options(MasterFormulation::INTEGER, 1, 1e-2, 1);
+  options.SUBPROBLEM_INITIAL_TOLERANCE = 1e-2;
+  BendersSequentialDouble benders(options, logger, writer, mathLoggerDriver);
+  benders.set_data(true, 0);
+  benders.launch();
+
+  benders.set_current_bounds(1000, 2000);
+  benders.UpdateSubproblemTolerance();
+  EXPECT_DOUBLE_EQ(benders.SubproblemTolerance(), 5e-3);
+
+  // a tolerance below the solvers' defaults is not a loose one
+  benders.set_current_bounds(1000, 1000.05);
+  benders.UpdateSubproblemTolerance();
+  EXPECT_EQ(benders.SubproblemTolerance(), 0);
+}
+
+TEST_F(BendersSequentialTest, LevelProjectionIsTheClosestPointBelowTheLevel) {
+  copyMasterMps();
+  BendersBaseOptions options =
+      init_benders_options(MasterFormulation::INTEGER, 1, 1e-2, 0.7);
+  options.MASTER_STABILIZATION = MasterStabilization::LEVEL_BUNDLE;
+  options.LEVEL_BUNDLE_PARAM = 0.5;
+  BendersSequentialDouble benders(options, logger, writer, mathLoggerDriver);
+  benders.set_master_variables({{"x1", 0}, {"x2", 1}});
+  benders.set_data(true, 0);
+  benders.launch();
+  const auto &solver = benders.get_master()->solver();
+  const int ncols = solver->get_ncols();
+  const int nrows = solver->get_nrows();
+  const auto obj_view = solver->get_obj_view();
+  const std::vector<double> obj(obj_view.begin(), obj_view.end());
+
+  // the master optimum is -23 at (3, 2): the level is -18, whose closest
+  // integer point to the origin is (2, 2)
+  benders.ProjectOnLevel({{"x1", 0}, {"x2", 0}}, -23, -13);
+
+  const auto data = benders.get_data();
+  EXPECT_NEAR(data.x_out.at("x1"), 2, 1e-6);
+  EXPECT_NEAR(data.x_out.at("x2"), 2, 1e-6);
+  EXPECT_NEAR(benders.LevelPointGap(), 5, 1e-6);
+  EXPECT_EQ(data.lb, -23);
+  EXPECT_EQ(solver->get_ncols(), ncols);
+  EXPECT_EQ(solver->get_nrows(), nrows);
+  const auto restored_obj = solver->get_obj_view();
+  EXPECT_EQ(std::vector<double>(restored_obj.begin(), restored_obj.end()),
+            obj);
+
+  // the level point is evaluated as is, without in-out separation
+  benders.NextXCut(data.x_out);
+  EXPECT_EQ(benders.get_data().x_cut, data.x_out);
+}
+
+TEST_F(BendersSequentialTest, EachPointOfTheSingleTreeIsSeparatedOnce) {
+  copyMasterMps();
+  BendersBaseOptions options =
+      init_benders_options(MasterFormulation::INTEGER, 1, 1e-2, 1);
+  BendersSequentialDouble benders(options, logger, writer, mathLoggerDriver);
+  benders.set_master_variables({{"x1", 0}, {"x2", 1}});
+  benders.set_data(true, 0);
+  benders.launch();
+
+  // without cuts, the first integer solution is accepted by the tree
+  std::vector<Point> separated_points;
+  benders.SolveMasterSingleTree([&benders, &separated_points] {
+    separated_points.push_back(benders.get_data().x_cut);
+  });
+
+  ASSERT_FALSE(separated_points.empty());
+  for (size_t i(1); i < separated_points.size(); ++i) {
+    EXPECT_NE(separated_points[i], separated_points[i - 1]);
+  }
+}
+
+TEST_F(BendersSequentialTest, SingleTreeEndsAtTheMasterOptimum) {
+  copyMasterMps();
+  BendersBaseOptions options =
+      init_benders_options(MasterFormulation::INTEGER, 1, 1e-2, 1);
+  BendersSequentialDouble benders(options, logger, writer, mathLoggerDriver);
+  benders.set_master_variables({{"x1", 0}, {"x2", 1}});
+  benders.set_data(true, 0);
+  benders.launch();
+
+  // without cuts, the tree ends at the optimum of the master, -23 at (3, 2)
+  benders.SolveMasterSingleTree([] {});
+
+  const auto data = benders.get_data();
+  EXPECT_NEAR(data.x_out.at("x1"), 3, 1e-6);
+  EXPECT_NEAR(data.x_out.at("x2"), 2, 1e-6);
+  EXPECT_NEAR(data.lb, -23, 1e-6);
+}
+
+TEST_F(BendersSequentialTest, ParetoCutIsTheBestAtTheCorePoint) {
+  copyMasterMps();
+  auto options =
+      init_benders_options(MasterFormulation::INTEGER, 1, 1e-2, 1);
+  options.PARETO_CUT_WEIGHT = 0.1;
+  BendersSequentialDouble benders(options, logger, writer, mathLoggerDriver);
+  SolverLogManager solver_log_manager;
+  // at t = 1, p = 1.5 both the production and the lines bound z: any split
+  // of the dual between t and p is optimal
+  auto worker = std::make_shared<SubproblemWorker>(
+      VariableMap({{"t", 0}, {"p", 1}}),
+      data_test_dir / "mini_network" / "SP1.mps", 1, "COIN", 0,
+      solver_log_manager, logger);
+  const Point x_cut = {{"t", 1}, {"p", 1.5}};
+
+  auto cut = benders.SolveParetoCut(worker, x_cut, {{"t", 2}, {"p", 1.5}});
+  EXPECT_NEAR(cut.subproblem_cost, 101.5, 1e-6);
+  EXPECT_NEAR(cut.cut_rhs(), 101.5, 1e-6);
+  EXPECT_NEAR(cut.var_name_and_subgradient["t"], 0, 1e-6);
+  EXPECT_NEAR(cut.var_name_and_subgradient["p"], -98.5 / 1.5, 1e-6);
+
+  cut = benders.SolveParetoCut(worker, x_cut, {{"t", 1}, {"p", 3}});
+  EXPECT_NEAR(cut.cut_rhs(), 101.5, 1e-6);
+  EXPECT_NEAR(cut.var_name_and_subgradient["t"], -98.5, 1e-6);
+  EXPECT_NEAR(cut.var_name_and_subgradient["p"], 0, 1e-6);
+}
+
+TEST(SubproblemWorkerTest, LagrangianGapBoundsTheCostOfALooseSolve) {
+  const auto mps =
+      std::filesystem::path("data_test") / "mini_network" / "SP1.mps";
+  Logger logger = std::make_shared<LoggerNOOPStub>();
+  SolverLogManager solver_log_manager;
+  SubproblemWorker exact({}, mps, 1, "COIN", 0, solver_log_manager, logger);
+  ASSERT_EQ(exact.solver()->solve_lp(), SOLVER_STATUS::OPTIMAL);
+  const double optimum = exact.solver()->get_lp_value();
+  double gap = -1;
+  exact.get_lagrangian_gap(gap);
+  EXPECT_NEAR(gap, 0, 1e-6);
+
+  SubproblemWorker loose({}, mps, 1, "COIN", 0, solver_log_manager, logger);
+  loose.set_dual_tolerance(1e-2);
+  ASSERT_EQ(loose.solver()->solve_lp(), SOLVER_STATUS::OPTIMAL);
+  const double cost = loose.solver()->get_lp_value();
+  loose.get_lagrangian_gap(gap);
+  EXPECT_GE(gap, 0);
+  EXPECT_GE(cost, optimum - 1e-6);
+  if (std::isfinite(gap)) {
+    EXPECT_LE(cost - gap, optimum + 1e-6);
+  }
+}
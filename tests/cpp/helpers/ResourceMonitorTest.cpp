@@ -0,0 +1,111 @@
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include "ResourceMonitor.h"
+#include "gtest/gtest.h"
+
+using namespace std::chrono_literals;
+
+class ResourceMonitorTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    std::filesystem::remove_all(directory_);
+    std::filesystem::create_directories(directory_ / "lp");
+  }
+  void TearDown() override { std::filesystem::remove_all(directory_); }
+
+  void write(const std::filesystem::path& file, size_t size) const {
+    std::ofstream(directory_ / file) << std::string(size, 'x');
+  }
+
+  const std::filesystem::path directory_ =
+      std::filesystem::temp_directory_path() / "resource_monitor_test";
+};
+
+TEST_F(ResourceMonitorTest, SampleMeasuresTheWatchedDirectory) {
+  write("a.txt", 1000);
+  write(std::filesystem::path("lp") / "b.mps", 234);
+
+  const auto sample = ResourceMonitor::Sample(directory_);
+  ASSERT_TRUE(sample.valid);
+  EXPECT_EQ(sample.watched_directory_bytes, 1234);
+#if defined(__unix__)
+  EXPECT_GT(sample.resident_set_bytes, 0);
+  EXPECT_GE(sample.peak_resident_set_bytes, sample.resident_set_bytes);
+  EXPECT_GT(sample.total_memory_bytes, 0);
+  EXPECT_GT(sample.available_disk_bytes, 0);
+#endif
+}
+
+TEST_F(ResourceMonitorTest, DisabledMonitorHasNoSample) {
+  const ResourceMonitor monitor(0, directory_);
+  EXPECT_FALSE(monitor.enabled());
+  EXPECT_FALSE(monitor.latest().valid);
+  std::ostringstream log;
+  log << monitor.latest();
+  EXPECT_EQ(log.str(), "no resource sample");
+}
+
+TEST_F(ResourceMonitorTest, LatestSampleIsAvailableAtOnce) {
+  write("a.txt", 10);
+  const ResourceMonitor monitor(3600, directory_);
+  const auto sample = monitor.latest();
+  ASSERT_TRUE(sample.valid);
+  EXPECT_EQ(sample.watched_directory_bytes, 10);
+}
+
+TEST_F(ResourceMonitorTest, SamplesFollowTheWatchedDirectory) {
+  ResourceMonitor monitor(0.01);
+  EXPECT_EQ(monitor.latest().watched_directory_bytes, 0);
+
+  write("a.txt", 100);
+  monitor.watch(directory_);
+  const auto deadline = std::chrono::steady_clock::now() + 10s;
+  while (monitor.latest().watched_directory_bytes != 100 &&
+         std::chrono::steady_clock::now() < deadline) {
+    std::this_thread::sleep_for(5ms);
+  }
+  EXPECT_EQ(monitor.latest().watched_directory_bytes, 100);
+}
+
+TEST_F(ResourceMonitorTest, MonitorStopsAtOnce) {
+  const auto start = std::chrono::steady_clock::now();
+  { const ResourceMonitor monitor(3600); }
+  EXPECT_LT(std::chrono::steady_clock::now() - start, 1s);
+}
+
+// benchmark on a 2000 files directory, run with --gtest_also_run_disabled_tests
+TEST_F(ResourceMonitorTest,
+       DISABLED_ReadingTheLatestSampleIsCheaperThanSampling) {
+  for (int file(0); file < 2000; ++file) {
+    write(std::filesystem::path("lp") / (std::to_string(file) + ".mps"), 1);
+  }
+  constexpr int reads = 100;
+
+  const auto sample_start = std::chrono::steady_clock::now();
+  uint64_t sampled = 0;
+  for (int read(0); read < reads; ++read) {
+    sampled += ResourceMonitor::Sample(directory_).watched_directory_bytes;
+  }
+  const std::chrono::duration<double> sample_time =
+      std::chrono::steady_clock::now() - sample_start;
+
+  const ResourceMonitor monitor(1, directory_);
+  const auto read_start = std::chrono::steady_clock::now();
+  uint64_t cached = 0;
+  for (int read(0); read < reads; ++read) {
+    cached += monitor.latest().watched_directory_bytes;
+  }
+  const std::chrono::duration<double> read_time =
+      std::chrono::steady_clock::now() - read_start;
+
+  EXPECT_EQ(cached, sampled);
+  std::cout << reads << " probes of a 2000 files directory: "
+            << sample_time.count() << " s, " << reads
+            << " reads of the latest sample: " << read_time.count() << " s"
+            << std::endl;
+}
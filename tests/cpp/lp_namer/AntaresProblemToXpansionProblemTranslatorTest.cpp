@@ -19,4 +19,22 @@ TEST(AntaresProblemToXpansionProblemTranslatorTest, convertSignToLEGSpanFailWith
 TEST(AntaresProblemToXpansionProblemTranslatorTest, NullCharIsInvalid) {
   std::vector<char> signs = {'<', '=', '\0'};
   ASSERT_THROW(AntaresProblemToXpansionProblemTranslator::convertSignToLEG(std::span<char>(signs.data(), signs.size())), std::runtime_error);
-}
\ No newline at end of file
+}
+TEST(AntaresProblemToXpansionProblemTranslatorTest, ConstantViewDoesNotCopyTheMatrix) {
+  Antares::Solver::ConstantDataFromAntares constant;
+  constant.VariablesCount = 3;
+  constant.ConstraintesCount = 2;
+  constant.CoeffCount = 4;
+  constant.Mdeb = {0, 2, 4};
+  constant.ColumnIndexes = {0, 1, 1, 2};
+  constant.ConstraintsMatrixCoeff = {1., 2., 3., 4.};
+
+  const AntaresConstantProblemView view(constant);
+  ASSERT_EQ(&view.constant, &constant);
+  ASSERT_EQ(static_cast<const void*>(view.row_starts.data()),
+            static_cast<const void*>(constant.Mdeb.data()));
+  ASSERT_EQ(static_cast<const void*>(view.column_indexes.data()),
+            static_cast<const void*>(constant.ColumnIndexes.data()));
+  ASSERT_EQ(view.column_indexes[2], 1);
+  ASSERT_EQ(view.column_starts, std::vector<int>(3, 0));
+}
@@ -0,0 +1,98 @@
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include "BoundedPipeline.h"
+#include "gtest/gtest.h"
+
+class BoundedPipelineTest : public ::testing::Test {
+ protected:
+  struct Item {
+    size_t index;
+    std::shared_ptr<int> alive;
+  };
+
+  std::atomic<int> alive_items_{0};
+  std::atomic<int> max_alive_items_{0};
+
+  std::shared_ptr<int> track() {
+    const auto alive = ++alive_items_;
+    int max = max_alive_items_;
+    while (alive > max && !max_alive_items_.compare_exchange_weak(max, alive)) {
+    }
+    return {new int(0), [this](int* p) {
+              --alive_items_;
+              delete p;
+            }};
+  }
+};
+
+TEST_F(BoundedPipelineTest, EveryItemIsReadModifiedAndWrittenOnce) {
+  const size_t count = 1000;
+  std::vector<std::atomic<int>> modified(count);
+  std::vector<std::atomic<int>> written(count);
+  PipelineOptions options;
+  options.queue_depth = 2;
+  options.workers = 3;
+
+  RunBoundedPipeline<Item>(
+      count, options, [this](size_t index) { return Item{index, track()}; },
+      [&](Item& item) { ++modified[item.index]; },
+      [&](Item& item) {
+        EXPECT_EQ(modified[item.index], 1);
+        ++written[item.index];
+      });
+
+  for (size_t index(0); index < count; ++index) {
+    EXPECT_EQ(written[index], 1) << index;
+  }
+  EXPECT_EQ(alive_items_, 0);
+}
+
+TEST_F(BoundedPipelineTest, ItemsInMemoryDoNotDependOnTheNumberOfItems) {
+  PipelineOptions options;
+  options.queue_depth = 1;
+  options.workers = 2;
+
+  RunBoundedPipeline<Item>(
+      5000, options, [this](size_t index) { return Item{index, track()}; },
+      [](Item&) {}, [](Item&) { std::this_thread::yield(); });
+
+  EXPECT_GT(max_alive_items_, 0);
+  EXPECT_LE(max_alive_items_, options.max_items_in_flight());
+}
+
+TEST_F(BoundedPipelineTest, FirstErrorStopsThePipelineAndIsRethrown) {
+  std::atomic<size_t> read{0};
+  PipelineOptions options;
+  options.queue_depth = 2;
+  options.workers = 2;
+
+  EXPECT_THROW(RunBoundedPipeline<Item>(
+                   100000, options,
+                   [&](size_t index) {
+                     ++read;
+                     return Item{index, track()};
+                   },
+                   [](Item& item) {
+                     if (item.index == 10) {
+                       throw std::runtime_error("modification failed");
+                     }
+                   },
+                   [](Item&) {}),
+               std::runtime_error);
+  EXPECT_LT(read, 100000);
+  EXPECT_EQ(alive_items_, 0);
+}
+
+TEST_F(BoundedPipelineTest, NoItem) {
+  int calls = 0;
+  RunBoundedPipeline<Item>(
+      0, {}, [&](size_t index) {
+        ++calls;
+        return Item{index, nullptr};
+      },
+      [&](Item&) { ++calls; }, [&](Item&) { ++calls; });
+  EXPECT_EQ(calls, 0);
+}
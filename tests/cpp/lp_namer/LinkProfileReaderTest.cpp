@@ -1,5 +1,8 @@
+#include <chrono>
 #include <fstream>
+#include <set>
 
+#include "ActiveLinks.h"
 #include "LinkProfileReader.h"
 #include "LoggerBuilder.h"
 #include "ProblemGenerationLogger.h"
@@ -154,7 +157,7 @@ TEST_F(LinkProfileReaderTest, MapContainLinkProfileOfCandidate) {
 
   auto profiles = LinkProfileReader(logger_).getLinkProfileMap({}, {candidate});
 
-  auto profile = profiles.at(VALID_DIRECT_PROFILE_NAME).at(0);
+  auto profile = profiles.at(VALID_DIRECT_PROFILE_NAME)->at(0);
   ASSERT_EQ(profile.getDirectProfile(0), 0);
   ASSERT_EQ(profile.getIndirectProfile(0), 0.25);
   ASSERT_EQ(profile.getDirectProfile(1), 0.5);
@@ -168,9 +171,160 @@ TEST_F(LinkProfileReaderTest, MapContainInstalledProfileOfCandidate) {
 
   auto profiles = LinkProfileReader(logger_).getLinkProfileMap({}, {candidate});
 
-  auto profile = profiles.at(VALID_DIRECT_PROFILE_NAME).at(0);
+  auto profile = profiles.at(VALID_DIRECT_PROFILE_NAME)->at(0);
   ASSERT_EQ(profile.getDirectProfile(0), 0);
   ASSERT_EQ(profile.getIndirectProfile(0), 0);
   ASSERT_EQ(profile.getDirectProfile(1), 0.5);
   ASSERT_EQ(profile.getIndirectProfile(1), 0.5);
-}
\ No newline at end of file
+}
+TEST_F(LinkProfileReaderTest, CachedProfileIsReadBackIdentically) {
+  const auto cache_directory =
+      std::filesystem::temp_directory_path() / "link_profile_cache_test";
+  std::filesystem::remove_all(cache_directory);
+
+  LinkProfileReader reader(logger_);
+  reader.setCacheDirectory(cache_directory);
+  const auto parsed =
+      reader.ReadLinkProfile(std::filesystem::path(VALID_DIRECT_PROFILE_NAME),
+                             std::filesystem::path(VALID_INDIRECT_PROFILE_NAME));
+  ASSERT_FALSE(std::filesystem::is_empty(cache_directory));
+
+  const auto cached =
+      reader.ReadLinkProfile(std::filesystem::path(VALID_DIRECT_PROFILE_NAME),
+                             std::filesystem::path(VALID_INDIRECT_PROFILE_NAME));
+  ASSERT_EQ(cached, parsed);
+  ASSERT_EQ(cached.at(0).getIndirectProfile(1), 0.75);
+
+  std::filesystem::remove_all(cache_directory);
+}
+
+TEST_F(LinkProfileReaderTest, CacheIsKeyedByProfileContent) {
+  const auto cache_directory =
+      std::filesystem::temp_directory_path() / "link_profile_cache_test";
+  std::filesystem::remove_all(cache_directory);
+  const std::string profile_name("temp_changing_profile.txt");
+
+  LinkProfileReader reader(logger_);
+  reader.setCacheDirectory(cache_directory);
+  std::vector<double> profile_values(8760, 1);
+  createProfileFile(profile_name, profile_values);
+  ASSERT_EQ(reader.ReadLinkProfile(profile_name).at(0).getDirectProfile(0), 1);
+
+  profile_values[0] = 0.5;
+  createProfileFile(profile_name, profile_values);
+  ASSERT_EQ(reader.ReadLinkProfile(profile_name).at(0).getDirectProfile(0),
+            0.5);
+
+  std::filesystem::remove(profile_name);
+  std::filesystem::remove_all(cache_directory);
+}
+
+TEST_F(LinkProfileReaderTest, OnlyOldUnusedCacheEntriesAreRemoved) {
+  const auto cache_directory =
+      std::filesystem::temp_directory_path() / "link_profile_cache_test";
+  std::filesystem::remove_all(cache_directory);
+  const auto read_profiles = [&cache_directory, this](
+                                 const std::string& direct_profile,
+                                 const std::string& indirect_profile) {
+    CandidateData candidate;
+    candidate.direct_link_profile = direct_profile;
+    candidate.indirect_link_profile = indirect_profile;
+    LinkProfileReader reader(logger_);
+    reader.setCacheDirectory(cache_directory);
+    reader.getLinkProfileMap({}, {candidate});
+  };
+  const auto entries = [&cache_directory] {
+    std::set<std::filesystem::path> result;
+    for (const auto& entry :
+         std::filesystem::directory_iterator(cache_directory)) {
+      result.insert(entry.path());
+    }
+    return result;
+  };
+  const auto long_ago =
+      std::filesystem::file_time_type::clock::now() - std::chrono::hours(24 * 60);
+
+  // entries of a study no longer run and of a study run recently
+  read_profiles(VALID_INDIRECT_PROFILE_NAME, VALID_DIRECT_PROFILE_NAME);
+  const auto old_entries = entries();
+  ASSERT_EQ(old_entries.size(), 1);
+  std::filesystem::last_write_time(*old_entries.begin(), long_ago);
+  read_profiles(VALID_DIRECT_PROFILE_NAME, VALID_DIRECT_PROFILE_NAME);
+  // files that are not entries of the cache
+  const auto user_file = cache_directory / "notes.bin";
+  const auto foreign_file = cache_directory / "123abc.bin";
+  const auto temporary_file = cache_directory / "456def.bin.tmp";
+  for (const auto& file : {user_file, foreign_file, temporary_file}) {
+    std::ofstream(file) << "not a profile";
+    std::filesystem::last_write_time(file, long_ago);
+  }
+  auto expected_entries = entries();
+  expected_entries.erase(*old_entries.begin());
+
+  read_profiles(VALID_DIRECT_PROFILE_NAME, VALID_INDIRECT_PROFILE_NAME);
+
+  auto remaining_entries = entries();
+  ASSERT_FALSE(remaining_entries.contains(*old_entries.begin()));
+  ASSERT_EQ(remaining_entries.size(), expected_entries.size() + 1);
+  for (const auto& entry : expected_entries) {
+    EXPECT_TRUE(remaining_entries.contains(entry)) << entry;
+  }
+
+  std::filesystem::remove_all(cache_directory);
+}
+
+TEST_F(LinkProfileReaderTest, CandidatesShareProfilesReadFromTheSameFiles) {
+  const int number_of_profiles = 20;
+  const int number_of_candidates = 500;
+  const int candidates_per_link = 10;
+  const auto capacity_folder =
+      std::filesystem::temp_directory_path() / "shared_profiles_test";
+  std::filesystem::create_directories(capacity_folder);
+
+  for (int profile_id(0); profile_id < number_of_profiles; ++profile_id) {
+    std::ofstream profile_file(capacity_folder /
+                               ("profile_" + std::to_string(profile_id)));
+    for (int hour(0); hour < NUMBER_OF_HOUR_PER_YEAR; ++hour) {
+      profile_file << (hour % (profile_id + 2)) / double(profile_id + 2)
+                   << "\t" << 1 << "\n";
+    }
+  }
+
+  std::vector<CandidateData> candidates(number_of_candidates);
+  for (int candidate_id(0); candidate_id < number_of_candidates;
+       ++candidate_id) {
+    auto& candidate = candidates[candidate_id];
+    const int link_id = candidate_id / candidates_per_link;
+    candidate.link_id = link_id;
+    candidate.link_name = "area" + std::to_string(link_id) + " - areab";
+    candidate.linkor = "area" + std::to_string(link_id);
+    candidate.linkex = "areab";
+    candidate.name = "candidate_" + std::to_string(candidate_id);
+    candidate.direct_link_profile =
+        "profile_" + std::to_string(candidate_id % number_of_profiles);
+    candidate.indirect_link_profile = candidate.direct_link_profile;
+  }
+
+  LinkProfileReader reader(logger_);
+  const auto profile_map = reader.getLinkProfileMap(capacity_folder, candidates);
+  ActiveLinksBuilder builder(candidates, profile_map,
+                             DirectAccessScenarioToChronicleProvider("", logger_),
+                             logger_);
+  const auto links = builder.getLinks();
+
+  std::set<const std::vector<LinkProfile>*> distinct_profiles;
+  size_t copied_memory = 0;
+  for (const auto& link : links) {
+    for (const auto& candidate : link.getCandidates()) {
+      distinct_profiles.insert(candidate.profiles().get());
+      copied_memory += ProfilesMemoryUsage(*candidate.profiles());
+    }
+  }
+  ASSERT_EQ(distinct_profiles.size(), number_of_profiles);
+  ASSERT_EQ(reader.store().size(), number_of_profiles);
+  ASSERT_EQ(reader.store().MemoryUsage() *
+                (number_of_candidates / number_of_profiles),
+            copied_memory);
+
+  std::filesystem::remove_all(capacity_folder);
+}
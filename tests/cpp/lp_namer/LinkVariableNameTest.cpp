@@ -0,0 +1,208 @@
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <set>
+
+#include "LinkVariableName.h"
+#include "LoggerBuilder.h"
+#include "Problem.h"
+#include "ProblemVariablesFromProblemAdapter.h"
+#include "StringManip.h"
+#include "gtest/gtest.h"
+#include "multisolver_interface/SolverFactory.h"
+#include "solver_utils.h"
+
+auto const reference_problem = std::filesystem::path("data_test") /
+                               "tests_lpnamer" / "SmallTestFiveCandidates" /
+                               "output" / "simulation" / "reference_lp" /
+                               "problem-1-1--optim-nb-1.mps";
+
+class LinkVariableNameTest : public ::testing::Test {
+ protected:
+  ProblemGenerationLog::ProblemGenerationLoggerSharedPointer logger =
+      emptyLogger();
+};
+
+TEST_F(LinkVariableNameTest, NtcVariableIsParsed) {
+  const auto variable =
+      ParseLinkVariableName("NTCDirect::link<area1$$area2>::hour<12>");
+  EXPECT_EQ(variable.type, LinkVariableType::NTC);
+  EXPECT_EQ(variable.link, "area1$$area2");
+  EXPECT_EQ(variable.time_step, 12);
+}
+
+TEST_F(LinkVariableNameTest, CostVariablesAreParsed) {
+  EXPECT_EQ(
+      ParseLinkVariableName("IntercoDirectCost::link<a$$b>::hour<0>").type,
+      LinkVariableType::DIRECT_COST);
+  EXPECT_EQ(
+      ParseLinkVariableName("IntercoIndirectCost::link<a$$b>::hour<167>")
+          .time_step,
+      167);
+}
+
+TEST_F(LinkVariableNameTest, OtherAndMalformedVariablesAreIgnored) {
+  for (const auto* name :
+       {"NegativeUnsuppliedEnergy::area<area1>::hour<0>", "peak",
+        "NTCDirect", "NTCDirect::link<area1>::hour<0>",
+        "NTCDirect::link<area1$$area2>", "NTCDirect::link<a$$b>::hour<x>"}) {
+    EXPECT_EQ(ParseLinkVariableName(name).type, LinkVariableType::NONE)
+        << name;
+  }
+}
+
+TEST_F(LinkVariableNameTest, LinksAreFoundWithSpacesWrittenAsStars) {
+  const std::vector<ActiveLink> links = {
+      ActiveLink(3, "l1", "area 1", "area2", 0, logger),
+      ActiveLink(5, "l2", "area2", "area 3", 0, logger)};
+  const LinkIndex index(links);
+
+  linkId id;
+  ASSERT_TRUE(index.find("area*1$$area2", id));
+  EXPECT_EQ(id, 3);
+  ASSERT_TRUE(index.find("area2$$area*3", id));
+  EXPECT_EQ(id, 5);
+  EXPECT_FALSE(index.find("area 1$$area2", id));
+  EXPECT_FALSE(index.find("area2$$area*1", id));
+}
+
+TEST_F(LinkVariableNameTest, AdapterSortsTheColumnsOfTheProblemByLink) {
+  const std::vector<std::string> names = {
+      "NTCDirect::link<area*1$$area2>::hour<0>",
+      "IntercoDirectCost::link<area*1$$area2>::hour<0>",
+      "IntercoIndirectCost::link<area2$$area*3>::hour<1>",
+      "NTCDirect::link<unknown$$area2>::hour<0>",
+      "NegativeUnsuppliedEnergy::area<area2>::hour<0>",
+      "NTCDirect::link<area2$$area*3>::hour<1>"};
+  SolverFactory factory;
+  auto problem = std::make_shared<Problem>(factory.create_solver("CBC"));
+  const auto n_cols = static_cast<int>(names.size());
+  solver_addcols(*problem, std::vector<double>(n_cols, 0),
+                 std::vector<int>(n_cols, 0), {}, {},
+                 std::vector<double>(n_cols, 0), std::vector<double>(n_cols, 1),
+                 std::vector<char>(n_cols, 'C'), names);
+  const std::vector<ActiveLink> links = {
+      ActiveLink(3, "l1", "area 1", "area2", 0, logger),
+      ActiveLink(5, "l2", "area2", "area 3", 0, logger)};
+
+  const auto variables =
+      ProblemVariablesFromProblemAdapter(problem, links, logger).Provide();
+
+  const std::map<colId, ColumnsToChange> expected_ntc = {
+      {3, {ColumnToChange(0, 0)}}, {5, {ColumnToChange(5, 1)}}};
+  const std::map<colId, ColumnsToChange> expected_direct_cost = {
+      {3, {ColumnToChange(1, 0)}}};
+  const std::map<colId, ColumnsToChange> expected_indirect_cost = {
+      {5, {ColumnToChange(2, 1)}}};
+  EXPECT_EQ(variables.ntc_columns, expected_ntc);
+  EXPECT_EQ(variables.direct_cost_columns, expected_direct_cost);
+  EXPECT_EQ(variables.indirect_cost_columns, expected_indirect_cost);
+}
+
+// the previous implementation, kept to check and time the new one
+std::map<linkId, ColumnsToChange> SplitAndSearch(
+    const std::vector<std::string>& names,
+    const std::vector<ActiveLink>& links) {
+  std::map<linkId, ColumnsToChange> result;
+  for (size_t index = 0; index < names.size(); ++index) {
+    const auto split_name = StringManip::split(names[index], "::");
+    if (split_name[0] != "NTCDirect") {
+      continue;
+    }
+    const auto zones = StringManip::split(
+        StringManip::split(StringManip::split(split_name[1], '<')[1], '>')[0],
+        "$$");
+    auto origin = zones[0];
+    std::replace(origin.begin(), origin.end(), '*', ' ');
+    auto destination = zones[1];
+    std::replace(destination.begin(), destination.end(), '*', ' ');
+    const auto time_step = std::stoi(
+        StringManip::split(StringManip::split(split_name[2], '<')[1], '>')[0]);
+    const auto it = std::find_if(
+        links.begin(), links.end(), [&origin, &destination](const auto& link) {
+          return link.linkor() == origin && link.linkex() == destination;
+        });
+    if (it != links.end()) {
+      result[it->get_idLink()].emplace_back(index, time_step);
+    }
+  }
+  return result;
+}
+
+std::map<linkId, ColumnsToChange> ParseAndHash(
+    const std::vector<std::string>& names, const LinkIndex& index) {
+  std::map<linkId, ColumnsToChange> result;
+  linkId id;
+  for (size_t column = 0; column < names.size(); ++column) {
+    const auto variable = ParseLinkVariableName(names[column]);
+    if (variable.type == LinkVariableType::NTC &&
+        index.find(variable.link, id)) {
+      result[id].emplace_back(column, variable.time_step);
+    }
+  }
+  return result;
+}
+
+// benchmark on a million names, run with --gtest_also_run_disabled_tests
+TEST_F(LinkVariableNameTest, DISABLED_AntaresColumnNamesParsingBenchmark) {
+  std::ifstream mps(reference_problem);
+  ASSERT_TRUE(mps.good());
+  std::vector<std::string> week_names;
+  std::set<std::string> links_fields;
+  std::string line;
+  bool in_columns = false;
+  while (std::getline(mps, line)) {
+    if (line.rfind("COLUMNS", 0) == 0) {
+      in_columns = true;
+      continue;
+    }
+    if (line.rfind("RHS", 0) == 0) {
+      break;
+    }
+    std::istringstream fields(line);
+    std::string name;
+    if (!in_columns || !(fields >> name) ||
+        (!week_names.empty() && week_names.back() == name)) {
+      continue;
+    }
+    week_names.push_back(name);
+    if (const auto variable = ParseLinkVariableName(name);
+        variable.type != LinkVariableType::NONE) {
+      links_fields.emplace(variable.link);
+    }
+  }
+  ASSERT_FALSE(links_fields.empty());
+
+  // one link per link of the study, behind as many links of other studies
+  std::vector<ActiveLink> links;
+  for (int other(0); other < 200; ++other) {
+    links.emplace_back(links.size(), "other", "x" + std::to_string(other), "y",
+                       0, logger);
+  }
+  for (const auto& field : links_fields) {
+    const auto zones = StringManip::split(field, "$$");
+    links.emplace_back(links.size(), field, zones[0], zones[1], 0, logger);
+  }
+
+  std::vector<std::string> names;
+  while (names.size() < 1000000) {
+    names.insert(names.end(), week_names.begin(), week_names.end());
+  }
+
+  const auto start = std::chrono::steady_clock::now();
+  const auto expected = SplitAndSearch(names, links);
+  const std::chrono::duration<double> split_time =
+      std::chrono::steady_clock::now() - start;
+
+  const auto parse_start = std::chrono::steady_clock::now();
+  const LinkIndex index(links);
+  const auto result = ParseAndHash(names, index);
+  const std::chrono::duration<double> parse_time =
+      std::chrono::steady_clock::now() - parse_start;
+
+  EXPECT_EQ(result, expected);
+  std::cout << names.size() << " column names: split and linear search "
+            << split_time.count() << " s, single pass parser and hashed links "
+            << parse_time.count() << " s" << std::endl;
+}
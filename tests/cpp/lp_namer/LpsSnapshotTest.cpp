@@ -0,0 +1,201 @@
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+
+#include "LpsSnapshot.h"
+#include "gtest/gtest.h"
+
+class LpsSnapshotTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    std::filesystem::remove_all(root_);
+    std::filesystem::create_directories(study_ / "input" / "links");
+    std::filesystem::create_directories(study_ / "settings");
+    std::filesystem::create_directories(simulation_);
+    write(simulation_ / "area-1.txt", "area1\n");
+    write(study_ / "study.antares", "[antares]\nversion = 880\n");
+    write(study_ / "settings" / "generaldata.ini", "[general]\nnbyears = 2\n");
+    write(study_ / "input" / "links" / "capacity.txt", "100\n200\n");
+  }
+  void TearDown() override { std::filesystem::remove_all(root_); }
+
+  static void write(const std::filesystem::path& file,
+                    const std::string& content) {
+    std::ofstream(file) << content;
+  }
+
+  static Antares::Solver::LpsFromAntares problems(unsigned int weeks,
+                                                  unsigned int variables) {
+    Antares::Solver::LpsFromAntares lps;
+    auto& constant = lps.constantProblemData;
+    constant.VariablesCount = variables;
+    constant.ConstraintesCount = 1;
+    constant.CoeffCount = variables;
+    constant.Mdeb = {0, variables};
+    for (unsigned int variable(0); variable < variables; ++variable) {
+      constant.ColumnIndexes.push_back(variable);
+      constant.ConstraintsMatrixCoeff.push_back(variable + 0.5);
+    }
+    for (unsigned int week(1); week <= weeks; ++week) {
+      Antares::Solver::WeeklyDataFromAntares hebdo;
+      hebdo.name = "problem-1-" + std::to_string(week);
+      hebdo.Direction = {'<'};
+      hebdo.RHS = {double(week)};
+      hebdo.LinearCost.assign(variables, 1.25 * week);
+      hebdo.Xmin.assign(variables, 0.);
+      hebdo.Xmax.assign(variables, 1e20);
+      for (unsigned int variable(0); variable < variables; ++variable) {
+        hebdo.variables.push_back("x" + std::to_string(variable));
+      }
+      hebdo.constraints = {"c"};
+      lps.weeklyProblems[{1, week}] = std::move(hebdo);
+    }
+    return lps;
+  }
+
+  static void expect_same(const Antares::Solver::LpsFromAntares& actual,
+                          const Antares::Solver::LpsFromAntares& expected) {
+    const auto& constant = actual.constantProblemData;
+    const auto& expected_constant = expected.constantProblemData;
+    EXPECT_EQ(constant.VariablesCount, expected_constant.VariablesCount);
+    EXPECT_EQ(constant.Mdeb, expected_constant.Mdeb);
+    EXPECT_EQ(constant.ColumnIndexes, expected_constant.ColumnIndexes);
+    EXPECT_EQ(constant.ConstraintsMatrixCoeff,
+              expected_constant.ConstraintsMatrixCoeff);
+    ASSERT_EQ(actual.weeklyProblems.size(), expected.weeklyProblems.size());
+    for (const auto& [id, hebdo] : expected.weeklyProblems) {
+      const auto& actual_hebdo = actual.weeklyProblems.at(id);
+      EXPECT_EQ(actual_hebdo.name, hebdo.name);
+      EXPECT_EQ(actual_hebdo.Direction, hebdo.Direction);
+      EXPECT_EQ(actual_hebdo.LinearCost, hebdo.LinearCost);
+      EXPECT_EQ(actual_hebdo.Xmax, hebdo.Xmax);
+      EXPECT_EQ(actual_hebdo.variables, hebdo.variables);
+    }
+  }
+
+  const std::filesystem::path root_ =
+      std::filesystem::temp_directory_path() / "lps_snapshot_test";
+  const std::filesystem::path study_ = root_ / "study";
+  const std::filesystem::path simulation_ = study_ / "output" / "simulation";
+  const std::filesystem::path cache_ = root_ / "cache";
+};
+
+TEST_F(LpsSnapshotTest, HashChangesWithTheInputs) {
+  const auto hash = StudyInputsHash(study_);
+  EXPECT_EQ(StudyInputsHash(study_), hash);
+
+  write(study_ / "output" / "results.txt", "not an input");
+  EXPECT_EQ(StudyInputsHash(study_), hash);
+
+  write(study_ / "input" / "links" / "capacity.txt", "100\n201\n");
+  const auto changed_content = StudyInputsHash(study_);
+  EXPECT_NE(changed_content, hash);
+
+  std::filesystem::rename(study_ / "input" / "links" / "capacity.txt",
+                          study_ / "input" / "links" / "capacity2.txt");
+  EXPECT_NE(StudyInputsHash(study_), changed_content);
+}
+
+TEST_F(LpsSnapshotTest, NoSnapshotForUnknownInputs) {
+  const LpsSnapshotCache cache(cache_);
+  EXPECT_FALSE(cache.load(StudyInputsHash(study_)).has_value());
+}
+
+TEST_F(LpsSnapshotTest, SavedProblemsAreLoaded) {
+  const LpsSnapshotCache cache(cache_);
+  const auto hash = StudyInputsHash(study_);
+  const auto lps = problems(3, 10);
+  cache.save(hash, lps, simulation_, 12.5);
+
+  const auto snapshot = cache.load(hash);
+  ASSERT_TRUE(snapshot.has_value());
+  EXPECT_EQ(snapshot->simulation_path, cache.simulationCopyPath(hash));
+  EXPECT_TRUE(
+      std::filesystem::exists(snapshot->simulation_path / "area-1.txt"));
+  EXPECT_EQ(snapshot->extraction_time, 12.5);
+  expect_same(snapshot->lps, lps);
+
+  EXPECT_FALSE(cache.load(hash + 1).has_value());
+}
+
+TEST_F(LpsSnapshotTest, SnapshotKeepsTheSimulationOutputAsItWas) {
+  const LpsSnapshotCache cache(cache_);
+  const auto hash = StudyInputsHash(study_);
+  cache.save(hash, problems(1, 2), simulation_, 1.);
+  std::filesystem::remove_all(simulation_);
+
+  const auto snapshot = cache.load(hash);
+  ASSERT_TRUE(snapshot.has_value());
+  EXPECT_TRUE(
+      std::filesystem::exists(snapshot->simulation_path / "area-1.txt"));
+}
+
+TEST_F(LpsSnapshotTest, SnapshotIsIgnoredWithoutItsSimulationCopy) {
+  const LpsSnapshotCache cache(cache_);
+  const auto hash = StudyInputsHash(study_);
+  cache.save(hash, problems(1, 2), simulation_, 1.);
+  std::filesystem::remove_all(cache.simulationCopyPath(hash));
+  EXPECT_FALSE(cache.load(hash).has_value());
+}
+
+TEST_F(LpsSnapshotTest, EachRestoreGetsItsOwnOutputDirectory) {
+  const LpsSnapshotCache cache(cache_);
+  const auto hash = StudyInputsHash(study_);
+  cache.save(hash, problems(1, 2), simulation_, 1.);
+  const auto snapshot = cache.load(hash);
+  ASSERT_TRUE(snapshot.has_value());
+
+  const auto output_root = study_ / "output";
+  const auto first =
+      RestoreSimulationOutput(snapshot->simulation_path, output_root);
+  const auto second =
+      RestoreSimulationOutput(snapshot->simulation_path, output_root);
+  EXPECT_NE(first, second);
+  EXPECT_NE(first, simulation_);
+  EXPECT_EQ(first.parent_path(), output_root);
+  EXPECT_TRUE(std::filesystem::exists(first / "area-1.txt"));
+  EXPECT_TRUE(std::filesystem::exists(second / "area-1.txt"));
+}
+
+TEST_F(LpsSnapshotTest, UnwritableSnapshotThrows) {
+  write(cache_, "a file where the cache directory should be");
+  const LpsSnapshotCache cache(cache_);
+  EXPECT_ANY_THROW(
+      cache.save(StudyInputsHash(study_), problems(1, 2), simulation_, 1.));
+}
+
+TEST_F(LpsSnapshotTest, TruncatedSnapshotIsIgnored) {
+  const LpsSnapshotCache cache(cache_);
+  const auto hash = StudyInputsHash(study_);
+  cache.save(hash, problems(2, 100), simulation_, 1.);
+  const auto path = cache.snapshotPath(hash);
+  std::filesystem::resize_file(path, std::filesystem::file_size(path) / 2);
+  EXPECT_FALSE(cache.load(hash).has_value());
+}
+
+// run with --gtest_also_run_disabled_tests
+TEST_F(LpsSnapshotTest, DISABLED_SnapshotLoadingBenchmark) {
+  // about the size of the problems of a mid-size study: 52 weeks of 50000
+  // variables sharing their matrix
+  const LpsSnapshotCache cache(cache_);
+  const auto hash = StudyInputsHash(study_);
+  const auto lps = problems(52, 50000);
+
+  const auto save_start = std::chrono::steady_clock::now();
+  cache.save(hash, lps, simulation_, 0.);
+  const std::chrono::duration<double> save_time =
+      std::chrono::steady_clock::now() - save_start;
+
+  const auto load_start = std::chrono::steady_clock::now();
+  const auto snapshot = cache.load(StudyInputsHash(study_));
+  const std::chrono::duration<double> load_time =
+      std::chrono::steady_clock::now() - load_start;
+
+  ASSERT_TRUE(snapshot.has_value());
+  expect_same(snapshot->lps, lps);
+  std::cout << "Snapshot of " << std::filesystem::file_size(
+                                     cache.snapshotPath(hash)) / (1 << 20)
+            << " MB: saved in " << save_time.count() << " s, hashed and loaded in "
+            << load_time.count() << " s" << std::endl;
+}
@@ -51,6 +51,7 @@ class NOOPSolver: public SolverAbstract {
     return std::vector<std::string>();
   }
   virtual void del_rows(int first, int last) override {}
+  virtual void del_cols(int first, int last) override {}
   virtual void add_rows(int newrows, int newnz, const char *qrtype,
                         const double *rhs, const double *range,
                         const int *mstart, const int *mclind,
@@ -77,6 +78,8 @@ class NOOPSolver: public SolverAbstract {
   virtual void chg_col_name(int id_col, const std::string &name) override {}
   virtual int solve_lp() override { return 0; }
   virtual int solve_mip() override { return 0; }
+  void set_mip_start(const std::vector<int> &mindex,
+                     const std::vector<double> &values) override {}
   virtual void get_basis(int *rstatus, int *cstatus) const override {}
   virtual double get_mip_value() const override { return 0; }
   virtual double get_lp_value() const override { return 0; }
@@ -88,6 +91,8 @@ class NOOPSolver: public SolverAbstract {
   virtual void set_algorithm(const std::string &algo) override {}
   virtual void set_threads(int n_threads) override {}
   virtual void set_optimality_gap(double gap) override {}
+  virtual void set_mip_relative_gap(double gap) override {}
+  virtual void set_dual_tolerance(double tolerance) override {}
   virtual void set_simplex_iter(int iter) override {}
   virtual void write_basis(const std::filesystem::path &filename) override {}
   virtual void read_basis(const std::filesystem::path &filename) override {}
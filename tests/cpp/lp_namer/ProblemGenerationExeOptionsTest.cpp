@@ -4,6 +4,7 @@
 #include "ProblemGeneration.h"
 #include "ProblemGenerationExeOptions.h"
 #include "gtest/gtest.h"
+#include "multisolver_interface/SolverAbstract.h"
 
 namespace po = boost::program_options;
 
@@ -75,6 +76,69 @@ TEST_F(ProblemGenerationExeOptionsTest, MasterFormulationDefaultValue) {
             std::string("relaxed"));
 }
 
+TEST_F(ProblemGenerationExeOptionsTest, MpsCompressionDefaultValue) {
+  parseOptions("--output", "something");
+  ASSERT_EQ(problem_generation_options_parser_.MpsCompression(),
+            std::string("none"));
+}
+
+TEST_F(ProblemGenerationExeOptionsTest, MpsCompressionOption) {
+  parseOptions("--output", "something", "--compression", "zstd");
+  ASSERT_EQ(problem_generation_options_parser_.MpsCompression(),
+            std::string("zstd"));
+}
+
+TEST_F(ProblemGenerationExeOptionsTest, UnknownMpsCompressionIsRejected) {
+  EXPECT_THROW(
+      parseOptions("--output", "something", "--compression", "rar"),
+      InvalidSolverOptionException);
+}
+
+TEST_F(ProblemGenerationExeOptionsTest, PipelineDefaultValues) {
+  parseOptions("--output", "something");
+  ASSERT_EQ(problem_generation_options_parser_.PipelineQueueDepth(), 4);
+  ASSERT_EQ(problem_generation_options_parser_.PipelineWorkers(), 0);
+}
+
+TEST_F(ProblemGenerationExeOptionsTest, PipelineOptions) {
+  parseOptions("--output", "something", "--queue-depth", "2", "--workers",
+               "8");
+  ASSERT_EQ(problem_generation_options_parser_.PipelineQueueDepth(), 2);
+  ASSERT_EQ(problem_generation_options_parser_.PipelineWorkers(), 8);
+}
+
+TEST_F(ProblemGenerationExeOptionsTest, LpsSnapshotDirIsEmptyByDefault) {
+  parseOptions("--study", "something");
+  ASSERT_TRUE(problem_generation_options_parser_.LpsSnapshotDir().empty());
+}
+
+TEST_F(ProblemGenerationExeOptionsTest, LpsSnapshotDir) {
+  parseOptions("--study", "something", "--lps-snapshot-dir", "cache");
+  ASSERT_EQ(problem_generation_options_parser_.LpsSnapshotDir(),
+            std::filesystem::path("cache"));
+}
+
+TEST_F(ProblemGenerationExeOptionsTest, ProfilesCacheIsDisabledByDefault) {
+  parseOptions("--output", "something");
+  ASSERT_TRUE(problem_generation_options_parser_.ProfilesCacheDir().empty());
+}
+
+TEST_F(ProblemGenerationExeOptionsTest, ProfilesCacheDir) {
+  parseOptions("--output", "something", "--profiles-cache-dir", "cache");
+  ASSERT_EQ(problem_generation_options_parser_.ProfilesCacheDir(),
+            std::filesystem::path("cache"));
+}
+
+TEST_F(ProblemGenerationExeOptionsTest, ResourceMonitorPeriodDefaultValue) {
+  parseOptions("--output", "something");
+  ASSERT_EQ(problem_generation_options_parser_.ResourceMonitorPeriod(), 1);
+}
+
+TEST_F(ProblemGenerationExeOptionsTest, ResourceMonitorPeriod) {
+  parseOptions("--output", "something", "--resource-monitor-period", "0.5");
+  ASSERT_EQ(problem_generation_options_parser_.ResourceMonitorPeriod(), 0.5);
+}
+
 // Base case: an empty tuple
 template <typename... Ts>
 auto flattenPairs(const std::tuple<Ts...>& tuple) {
@@ -929,6 +929,28 @@ TEST_F(
              {P_MINUS_id, cand1_id, cand2_id},
              link_capacity * profile_link.getIndirectProfile(1));
 }
+TEST_F(ProblemModifierTestMultiChronicle,
+       coefficientTablesAreSharedByTheYearsOfTheSameChronicle) {
+  LinkCoefficientTables tables;
+  const auto& link = links.at(0);
+  const auto& year_1 = tables.get(link, link.chronicle(1));
+  const auto& year_2 = tables.get(link, link.chronicle(2));
+  const auto& unmapped_year = tables.get(link, link.chronicle(42));
+
+  EXPECT_EQ(&unmapped_year, &year_1);
+  EXPECT_NE(&year_2, &year_1);
+  EXPECT_EQ(tables.size(), 2);
+
+  ASSERT_EQ(year_2.number_of_candidates(), 2);
+  EXPECT_EQ(year_2.installed_direct(1),
+            link_capacity * profile_link.getDirectProfile(1));
+  EXPECT_EQ(year_2.installed_indirect(1),
+            link_capacity * profile_link.getIndirectProfile(1));
+  EXPECT_EQ(year_2.direct(1)[0], profile_cand1_2.getDirectProfile(1));
+  EXPECT_EQ(year_2.indirect(1)[1], profile_cand2_2.getIndirectProfile(1));
+  EXPECT_EQ(year_1.direct(0)[1], profile_cand2.getDirectProfile(0));
+}
+
 TEST_F(ProblemModifierTestMultiChronicle, candidateWithNotNullProfileExists) {
   auto problem_modifier = ProblemModifier(logger);
   math_problem->mc_year = 2;
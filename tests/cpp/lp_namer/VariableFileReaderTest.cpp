@@ -1,4 +1,6 @@
+#include <chrono>
 #include <fstream>
+#include <iostream>
 
 #include "LoggerBuilder.h"
 #include "VariableFileReader.h"
@@ -261,3 +263,156 @@ TEST_F(VariableFileReaderTest, ReadCostColumnsWithMultipleActiveLink) {
   expectedIndirectCostVarColumns[2] = {{4, 18}};
   ASSERT_EQ(indirectCostVarColumns, expectedIndirectCostVarColumns);
 }
+
+// stream based reading of the previous implementation, to check and time the
+// in place tokenization
+struct StreamReadVariables {
+  std::vector<std::string> variables;
+  std::map<linkId, ColumnsToChange> ntc;
+  std::map<linkId, ColumnsToChange> direct_cost;
+  std::map<linkId, ColumnsToChange> indirect_cost;
+};
+
+StreamReadVariables ReadWithStreams(const std::filesystem::path& file_name,
+                                    const std::vector<ActiveLink>& links,
+                                    const VariableFileReadNameConfiguration&
+                                        variable_name_config) {
+  StreamReadVariables result;
+  std::ifstream file(file_name);
+  std::string line;
+  while (std::getline(file, line)) {
+    std::ostringstream name;
+    {
+      std::istringstream buffer(line);
+      std::string part;
+      bool is_first(true);
+      while (buffer >> part) {
+        if (!is_first) {
+          name << part << "_";
+        } else {
+          is_first = false;
+        }
+      }
+    }
+    result.variables.push_back(name.str());
+
+    std::istringstream buffer(line);
+    colId id;
+    std::string variable;
+    int pays;
+    int link_id;
+    unsigned int time_step;
+    buffer >> id;
+    buffer >> variable;
+    if (variable == variable_name_config.ntc_variable_name) {
+      buffer >> pays >> link_id >> time_step;
+      updateMapColumn(links, link_id, id, time_step, result.ntc);
+    } else if (variable == variable_name_config.cost_extremite_variable_name) {
+      buffer >> link_id >> time_step;
+      updateMapColumn(links, link_id, id, time_step, result.indirect_cost);
+    } else if (variable == variable_name_config.cost_origin_variable_name) {
+      buffer >> link_id >> time_step;
+      updateMapColumn(links, link_id, id, time_step, result.direct_cost);
+    }
+  }
+  return result;
+}
+
+VariableFileReadNameConfiguration AntaresVariableNames() {
+  VariableFileReadNameConfiguration variable_name_config;
+  variable_name_config.ntc_variable_name = "ValeurDeNTCOrigineVersExtremite";
+  variable_name_config.cost_origin_variable_name =
+      "CoutOrigineVersExtremiteDeLInterconnexion";
+  variable_name_config.cost_extremite_variable_name =
+      "CoutExtremiteVersOrigineDeLInterconnexion";
+  return variable_name_config;
+}
+
+TEST_F(VariableFileReaderTest, SameColumnsAsStreamReadingOnDataTest) {
+  auto logger = emptyLogger();
+  std::vector<ActiveLink> links;
+  for (int link_id(0); link_id < 5; ++link_id) {
+    links.emplace_back(link_id, "link", "from", "to", 0, logger);
+  }
+  const auto variable_name_config = AntaresVariableNames();
+
+  int files = 0;
+  for (const auto& entry : std::filesystem::recursive_directory_iterator(
+           std::filesystem::path("data_test") / "tests_lpnamer")) {
+    const auto file_name = entry.path().filename().string();
+    if (!entry.is_regular_file() || file_name.rfind("variables-", 0) != 0 ||
+        entry.path().extension() != ".txt") {
+      continue;
+    }
+    ++files;
+    const auto expected =
+        ReadWithStreams(entry.path(), links, variable_name_config);
+    VariableFileReader varReader(entry.path(), links, variable_name_config,
+                                 logger);
+    EXPECT_EQ(varReader.getVariables(), expected.variables) << entry.path();
+    EXPECT_EQ(varReader.getNtcVarColumns(), expected.ntc) << entry.path();
+    EXPECT_EQ(varReader.getDirectCostVarColumns(), expected.direct_cost)
+        << entry.path();
+    EXPECT_EQ(varReader.getIndirectCostVarColumns(), expected.indirect_cost)
+        << entry.path();
+  }
+  EXPECT_GT(files, 0);
+}
+
+// benchmark on a 50 MB file, run with --gtest_also_run_disabled_tests
+TEST_F(VariableFileReaderTest, DISABLED_MillionLinesFileReadingBenchmark) {
+  auto logger = emptyLogger();
+  const int n_links = 300;
+  std::vector<ActiveLink> links;
+  for (int link_id(0); link_id < n_links; link_id += 3) {
+    links.emplace_back(link_id, "link", "from", "to", 0, logger);
+  }
+  const auto variable_name_config = AntaresVariableNames();
+
+  const auto file_name =
+      std::filesystem::temp_directory_path() / std::tmpnam(nullptr);
+  {
+    std::ofstream file(file_name);
+    const int n_lines = 1000000;
+    for (int line(0); line < n_lines; ++line) {
+      const int time_step = line % 168;
+      switch (line % 10) {
+        case 0:
+          file << line << " ValeurDeNTCOrigineVersExtremite 0 "
+               << line % n_links << " " << time_step << " \n";
+          break;
+        case 1:
+          file << line << " CoutOrigineVersExtremiteDeLInterconnexion "
+               << line % n_links << " " << time_step << " \n";
+          break;
+        case 2:
+          file << line << " CoutExtremiteVersOrigineDeLInterconnexion "
+               << line % n_links << " " << time_step << " \n";
+          break;
+        default:
+          file << line << " PalierThermique " << line % 50 << " "
+               << line % 7 << " " << time_step << " \n";
+      }
+    }
+  }
+
+  const auto start = std::chrono::steady_clock::now();
+  const auto expected =
+      ReadWithStreams(file_name, links, variable_name_config);
+  const std::chrono::duration<double> stream_time =
+      std::chrono::steady_clock::now() - start;
+
+  const auto read_start = std::chrono::steady_clock::now();
+  VariableFileReader varReader(file_name, links, variable_name_config, logger);
+  const std::chrono::duration<double> read_time =
+      std::chrono::steady_clock::now() - read_start;
+
+  EXPECT_EQ(varReader.getVariables(), expected.variables);
+  EXPECT_EQ(varReader.getNtcVarColumns(), expected.ntc);
+  EXPECT_EQ(varReader.getDirectCostVarColumns(), expected.direct_cost);
+  EXPECT_EQ(varReader.getIndirectCostVarColumns(), expected.indirect_cost);
+  std::cout << expected.variables.size() << " lines: streams "
+            << stream_time.count() << " s, mapped file "
+            << read_time.count() << " s" << std::endl;
+  std::filesystem::remove(file_name);
+}
@@ -1,3 +1,5 @@
+#include <algorithm>
+#include <chrono>
 #include <iostream>
 
 #include "catch2.hpp"
@@ -42,6 +44,50 @@ TEST_CASE("Modification: deleting rows", "[modif][del-rows]") {
   }
 }
 
+TEST_CASE("Modification: deleting columns", "[modif][del-cols]") {
+  AllDatas datas;
+  fill_datas(datas);
+
+  SolverFactory factory;
+
+  auto inst = GENERATE(MIP_TOY, MULTIKP);
+  SECTION("Loop on instances") {
+    for (auto const& solver_name : factory.get_solvers_list()) {
+      std::filesystem::path instance = datas[inst]._path;
+      SolverAbstract::Ptr solver = factory.create_solver(solver_name);
+      solver->read_prob_mps(instance, false);
+      const int ncols = solver->get_ncols();
+      const int nelems = solver->get_nelems();
+      std::vector<double> obj(ncols);
+      solver->get_obj(obj.data(), 0, ncols - 1);
+      const auto col_names = solver->get_col_names();
+
+      // two columns in the first two rows, then deleted
+      std::vector<double> newobj(2, 3.0), lb(2, 0.0), ub(2, 1.0);
+      std::vector<int> mstart = {0, 2};
+      std::vector<int> mind = {0, 1, 0, 1};
+      std::vector<double> matval(4, 1.0);
+      solver->add_cols(2, 4, newobj.data(), mstart.data(), mind.data(),
+                       matval.data(), lb.data(), ub.data());
+      REQUIRE(solver->get_nelems() == nelems + 4);
+      solver->del_cols(ncols, ncols + 1);
+
+      REQUIRE(solver->get_ncols() == ncols);
+      REQUIRE(solver->get_nelems() == nelems);
+      std::vector<double> obj_after(ncols);
+      solver->get_obj(obj_after.data(), 0, ncols - 1);
+      REQUIRE(obj_after == obj);
+
+      // the next columns are shifted
+      REQUIRE(solver->get_col_index(col_names[1]) == 1);
+      solver->del_cols(0, 0);
+      REQUIRE(solver->get_ncols() == ncols - 1);
+      REQUIRE(solver->get_col_index(col_names[0]) == -1);
+      REQUIRE(solver->get_col_index(col_names[1]) == 0);
+    }
+  }
+}
+
 TEST_CASE("Modification: add rows", "[modif][add-rows]") {
   AllDatas datas;
   fill_datas(datas);
@@ -433,6 +479,160 @@ TEST_CASE("Modification: change name of row and column", "[modif][chg-names]") {
   }
 }
 
+TEST_CASE("Modification: name lookups follow the problem changes",
+          "[modif][name-index]") {
+  AllDatas datas;
+  fill_datas(datas);
+
+  SolverFactory factory;
+
+  for (auto const& solver_name : factory.get_solvers_list()) {
+    if (solver_name == "XPRESS") {
+      // names are looked up by Xpress itself
+      continue;
+    }
+    SolverAbstract::Ptr solver = factory.create_solver(solver_name);
+    solver->read_prob_mps(datas[MULTIKP]._path, false);
+    const auto col_names = solver->get_col_names();
+    const auto row_names = solver->get_row_names();
+    const int ncols = solver->get_ncols();
+    const int nrows = solver->get_nrows();
+
+    // first lookups build the indexes
+    REQUIRE(solver->get_col_index(col_names.back()) == ncols - 1);
+    REQUIRE(solver->get_row_index(row_names.back()) == nrows - 1);
+    REQUIRE(solver->get_col_index("unknown") == -1);
+
+    std::vector<double> obj(1, 1.0), lb(1, 0.0), ub(1, 1.0);
+    std::vector<int> mstart(1, 0);
+    solver->add_cols(1, 0, obj.data(), mstart.data(), nullptr, nullptr,
+                     lb.data(), ub.data());
+    solver->chg_col_name(ncols, "new_col");
+    REQUIRE(solver->get_col_index("new_col") == ncols);
+
+    std::vector<char> types(2, 'L');
+    std::vector<double> rhs = {1.0, 2.0};
+    std::vector<int> rstart = {0, 1, 2};
+    std::vector<int> rind(2, ncols);
+    std::vector<double> rval(2, 1.0);
+    solver->add_rows(2, 2, types.data(), rhs.data(), nullptr, rstart.data(),
+                     rind.data(), rval.data(), {"cut_1", "cut_2"});
+    REQUIRE(solver->get_row_index("cut_1") == nrows);
+    REQUIRE(solver->get_row_index("cut_2") == nrows + 1);
+
+    // the next rows are shifted
+    solver->del_rows(0, 0);
+    REQUIRE(solver->get_row_index(row_names[0]) == -1);
+    REQUIRE(solver->get_row_index(row_names[1]) == 0);
+    REQUIRE(solver->get_row_index("cut_2") == nrows);
+
+    // deleting the last rows
+    solver->del_rows(nrows - 1, nrows);
+    REQUIRE(solver->get_row_index("cut_1") == -1);
+    REQUIRE(solver->get_row_index("cut_2") == -1);
+    REQUIRE(solver->get_row_index(row_names.back()) == nrows - 2);
+
+    solver->chg_col_name(0, "renamed");
+    REQUIRE(solver->get_col_index("renamed") == 0);
+    REQUIRE(solver->get_col_index(col_names[0]) == -1);
+    REQUIRE(solver->get_col_index(col_names[1]) == 1);
+
+    // a new problem replaces the indexes
+    solver->read_prob_mps(datas[MULTIKP]._path, false);
+    REQUIRE(solver->get_col_index(col_names[0]) == 0);
+    REQUIRE(solver->get_col_index("new_col") == -1);
+  }
+}
+
+TEST_CASE("Modification: name lookups with duplicate names",
+          "[modif][name-index]") {
+  AllDatas datas;
+  fill_datas(datas);
+
+  SolverFactory factory;
+
+  for (auto const& solver_name : factory.get_solvers_list()) {
+    if (solver_name == "XPRESS") {
+      continue;
+    }
+    SolverAbstract::Ptr solver = factory.create_solver(solver_name);
+    solver->read_prob_mps(datas[MULTIKP]._path, false);
+    const int ncols = solver->get_ncols();
+    const int nrows = solver->get_nrows();
+    REQUIRE(solver->get_col_index("twin") == -1);
+
+    std::vector<double> obj(2, 1.0), lb(2, 0.0), ub(2, 1.0);
+    std::vector<int> mstart(2, 0);
+    solver->add_cols(2, 0, obj.data(), mstart.data(), nullptr, nullptr,
+                     lb.data(), ub.data());
+    solver->chg_col_name(ncols, "twin");
+    solver->chg_col_name(ncols + 1, "twin");
+    REQUIRE(solver->get_col_index("twin") == ncols);
+    // the other twin is found once the first one is renamed
+    solver->chg_col_name(ncols, "single");
+    REQUIRE(solver->get_col_index("twin") == ncols + 1);
+    REQUIRE(solver->get_col_index("single") == ncols);
+
+    std::vector<char> types(3, 'L');
+    std::vector<double> rhs = {1.0, 2.0, 3.0};
+    std::vector<int> rstart = {0, 1, 2, 3};
+    std::vector<int> rind(3, ncols);
+    std::vector<double> rval(3, 1.0);
+    solver->add_rows(3, 3, types.data(), rhs.data(), nullptr, rstart.data(),
+                     rind.data(), rval.data(), {"dup", "dup", "last"});
+    REQUIRE(solver->get_row_index("dup") == nrows);
+    // the second duplicate is shifted in place of the first one
+    solver->del_rows(nrows, nrows);
+    REQUIRE(solver->get_row_index("dup") == nrows);
+    REQUIRE(solver->get_row_index("last") == nrows + 1);
+  }
+}
+
+TEST_CASE("Name lookups on a large problem", "[.][benchmark][name-index]") {
+  SolverFactory factory;
+
+  const int n_cols = 1000000;
+  const int n_lookups = 1000;
+  for (auto const& solver_name : factory.get_solvers_list()) {
+    if (solver_name == "XPRESS") {
+      continue;
+    }
+    SolverAbstract::Ptr solver = factory.create_solver(solver_name);
+    std::vector<double> obj(n_cols, 1.0), lb(n_cols, 0.0), ub(n_cols, 1.0);
+    std::vector<int> mstart(n_cols, 0);
+    solver->add_cols(n_cols, 0, obj.data(), mstart.data(), nullptr, nullptr,
+                     lb.data(), ub.data());
+    for (int col(0); col < n_cols; col++) {
+      solver->chg_col_name(col, "x" + std::to_string(col));
+    }
+
+    // what each lookup cost before: a scan of every name
+    const auto scan_start = std::chrono::steady_clock::now();
+    long long scanned = 0;
+    const auto names = solver->get_col_names();
+    for (int lookup(0); lookup < n_lookups; lookup++) {
+      const auto name = "x" + std::to_string(n_cols - 1 - lookup);
+      scanned += std::find(names.begin(), names.end(), name) - names.begin();
+    }
+    const std::chrono::duration<double> scan_time =
+        std::chrono::steady_clock::now() - scan_start;
+
+    const auto start = std::chrono::steady_clock::now();
+    long long found = 0;
+    for (int lookup(0); lookup < n_lookups; lookup++) {
+      found += solver->get_col_index("x" + std::to_string(n_cols - 1 - lookup));
+    }
+    const std::chrono::duration<double> lookup_time =
+        std::chrono::steady_clock::now() - start;
+
+    REQUIRE(found == scanned);
+    std::cout << solver_name << " : " << n_lookups << " lookups among "
+              << n_cols << " columns, " << scan_time.count()
+              << " s by scanning, " << lookup_time.count()
+              << " s with the index (built by the first one)" << std::endl;
+  }
+}
+
 TEST_CASE("Modification: add cols and a row associated to those columns",
           "[modif][add-cols-rows]") {
   AllDatas datas;
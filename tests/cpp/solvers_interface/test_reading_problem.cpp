@@ -1,4 +1,5 @@
 #include <iostream>
+#include <numeric>
 
 #include "catch2.hpp"
 #include "define_datas.hpp"
@@ -218,6 +219,113 @@ TEST_CASE("MPS file can be read and we can get matrix coefficients",
   }
 }
 
+TEST_CASE("MPS file can be read and we can view the matrix without copy",
+          "[read][read-views]") {
+  AllDatas datas;
+  fill_datas(datas);
+
+  SolverFactory factory;
+
+  auto inst = GENERATE(MIP_TOY, MULTIKP, UNBD_PRB, INFEAS_PRB, NET_MASTER,
+                       NET_SP1, NET_SP2);
+  SECTION("Reading instance") {
+    for (auto const& solver_name : factory.get_solvers_list()) {
+      std::filesystem::path instance = datas[inst]._path;
+      SolverAbstract::Ptr solver = factory.create_solver(solver_name);
+      solver->read_prob_mps(instance, false);
+
+      const auto rows = solver->get_rows_view();
+      REQUIRE(rows.number_of_vectors() == datas[inst]._nrows);
+      REQUIRE(rows.number_of_elements() == datas[inst]._nelems);
+      REQUIRE(std::vector<int>(rows.starts.begin(), rows.starts.end()) ==
+              datas[inst]._mstart);
+      REQUIRE(std::vector<int>(rows.indexes.begin(), rows.indexes.end()) ==
+              datas[inst]._mind);
+      REQUIRE(std::vector<double>(rows.values.begin(), rows.values.end()) ==
+              datas[inst]._matval);
+
+      // same matrix, column by column
+      const auto cols = solver->get_cols_view();
+      const auto expected_cols =
+          TransposedMatrix(rows, solver->get_ncols());
+      REQUIRE(cols.number_of_vectors() == datas[inst]._ncols);
+      REQUIRE(std::vector<int>(cols.starts.begin(), cols.starts.end()) ==
+              std::vector<int>(expected_cols.starts.begin(),
+                               expected_cols.starts.end()));
+      REQUIRE(std::vector<int>(cols.indexes.begin(), cols.indexes.end()) ==
+              std::vector<int>(expected_cols.indexes.begin(),
+                               expected_cols.indexes.end()));
+      REQUIRE(std::vector<double>(cols.values.begin(), cols.values.end()) ==
+              std::vector<double>(expected_cols.values.begin(),
+                                  expected_cols.values.end()));
+
+      const auto obj = solver->get_obj_view();
+      const auto lb = solver->get_lb_view();
+      const auto ub = solver->get_ub_view();
+      REQUIRE(std::vector<double>(obj.begin(), obj.end()) == datas[inst]._obj);
+      REQUIRE(std::vector<double>(lb.begin(), lb.end()) == datas[inst]._lb);
+      REQUIRE(std::vector<double>(ub.begin(), ub.end()) == datas[inst]._ub);
+      if (solver_name == "CBC") {
+        REQUIRE(rows.starts.borrowed());
+        REQUIRE(obj.borrowed());
+      }
+      if (solver_name == "CLP") {
+        REQUIRE(obj.borrowed());
+      }
+    }
+  }
+}
+
+TEST_CASE("Matrix views follow the rows added to the problem",
+          "[read][read-views]") {
+  AllDatas datas;
+  fill_datas(datas);
+
+  SolverFactory factory;
+
+  for (auto const& solver_name : factory.get_solvers_list()) {
+    SolverAbstract::Ptr solver = factory.create_solver(solver_name);
+    solver->read_prob_mps(datas[MULTIKP]._path, false);
+    const int ncols = solver->get_ncols();
+
+    // a row on every column leaves gaps in a column ordered matrix
+    std::vector<char> types(1, 'L');
+    std::vector<double> rhs(1, 10.0);
+    std::vector<int> rstart = {0, ncols};
+    std::vector<int> rind(ncols);
+    std::iota(rind.begin(), rind.end(), 0);
+    std::vector<double> rval(ncols, 2.0);
+    solver->add_rows(1, ncols, types.data(), rhs.data(), nullptr,
+                     rstart.data(), rind.data(), rval.data());
+
+    const int nrows = solver->get_nrows();
+    const int nelems = solver->get_nelems();
+    std::vector<int> mstart(nrows + 1);
+    std::vector<int> mind(nelems);
+    std::vector<double> matval(nelems);
+    int n_returned(0);
+    solver->get_rows(mstart.data(), mind.data(), matval.data(), nelems,
+                     &n_returned, 0, nrows - 1);
+
+    const auto rows = solver->get_rows_view();
+    REQUIRE(std::vector<int>(rows.starts.begin(), rows.starts.end()) ==
+            mstart);
+    REQUIRE(std::vector<int>(rows.indexes.begin(), rows.indexes.end()) ==
+            mind);
+    REQUIRE(std::vector<double>(rows.values.begin(), rows.values.end()) ==
+            matval);
+
+    const auto cols = solver->get_cols_view();
+    REQUIRE(cols.number_of_vectors() == ncols);
+    REQUIRE(cols.number_of_elements() == nelems);
+    for (int col(0); col < ncols; ++col) {
+      // the new row is the last element of each column
+      REQUIRE(cols.indexes[cols.starts[col + 1] - 1] == nrows - 1);
+      REQUIRE(cols.values[cols.starts[col + 1] - 1] == 2.0);
+    }
+  }
+}
+
 TEST_CASE("MPS file can be read and we can get right hand side",
           "[read][read-rhs]") {
   AllDatas datas;
@@ -1,4 +1,7 @@
+#include <algorithm>
+#include <cmath>
 #include <iostream>
+#include <numeric>
 
 #include "catch2.hpp"
 #include "define_datas.hpp"
@@ -260,4 +263,242 @@ TEST_CASE("A problem is solved and we can get the optimal solution",
       }
     }
   }
-}
\ No newline at end of file
+}
+TEST_CASE("A MIP solved again after adding rows gives the same optimum as a "
+          "new solver",
+          "[solve-mip][resolve]") {
+  AllDatas datas;
+  fill_datas(datas);
+
+  SolverFactory factory;
+
+  for (auto const& solver_name : factory.get_solvers_list()) {
+    // As CLP is a pure LP solver, it cannot pass this test
+    if (solver_name == "CLP") {
+      continue;
+    }
+    std::filesystem::path instance = datas[MULTIKP]._path;
+    SolverAbstract::Ptr solver = factory.create_solver(solver_name);
+    solver->read_prob_mps(instance, false);
+    REQUIRE(solver->solve_mip() == SOLVER_STATUS::OPTIMAL);
+
+    const int ncols = solver->get_ncols();
+    std::vector<int> rstart = {0, ncols};
+    std::vector<int> rind(ncols);
+    std::iota(rind.begin(), rind.end(), 0);
+    std::vector<double> rval(ncols, 1.0);
+    std::vector<char> rtype(1, 'L');
+
+    SolverAbstract::Ptr reference = factory.create_solver(solver_name);
+    reference->read_prob_mps(instance, false);
+    // cuts, as a Benders master would add them, then a bound change
+    for (int step(0); step < 3; ++step) {
+      if (step < 2) {
+        std::vector<double> rhs(1, 2.0 - step);
+        solver->add_rows(1, ncols, rtype.data(), rhs.data(), nullptr,
+                         rstart.data(), rind.data(), rval.data());
+        reference->add_rows(1, ncols, rtype.data(), rhs.data(), nullptr,
+                            rstart.data(), rind.data(), rval.data());
+      } else {
+        solver->chg_bounds({0}, {'U'}, {0.0});
+        reference->chg_bounds({0}, {'U'}, {0.0});
+      }
+      REQUIRE(solver->solve_mip() == SOLVER_STATUS::OPTIMAL);
+
+      SolverAbstract::Ptr fresh = factory.copy_solver(reference);
+      REQUIRE(fresh->solve_mip() == SOLVER_STATUS::OPTIMAL);
+      REQUIRE(solver->get_mip_value() == Approx(fresh->get_mip_value()));
+
+      std::vector<double> primals(ncols);
+      solver->get_mip_sol(primals.data());
+      double sum = 0;
+      for (auto const value : primals) {
+        sum += value;
+      }
+      REQUIRE(sum <= 2.0 - std::min(step, 1) + 1e-6);
+      REQUIRE(primals[0] <= (step == 2 ? 1e-6 : 1.0 + 1e-6));
+    }
+  }
+}
+
+TEST_CASE("A MIP started from a given solution reaches the same optimum",
+          "[solve-mip][mip-start]") {
+  AllDatas datas;
+  fill_datas(datas);
+
+  SolverFactory factory;
+
+  auto inst = GENERATE(MIP_TOY, MULTIKP);
+  SECTION("Loop on the instances") {
+    for (auto const& solver_name : factory.get_solvers_list()) {
+      // As CLP is a pure LP solver, it cannot pass this test
+      if (solver_name == "CLP") {
+        continue;
+      }
+      std::filesystem::path instance = datas[inst]._path;
+      SolverAbstract::Ptr solver = factory.create_solver(solver_name);
+      solver->read_prob_mps(instance, false);
+      REQUIRE(solver->solve_mip() == SOLVER_STATUS::OPTIMAL);
+      const double optimum = solver->get_mip_value();
+      std::vector<double> primals(solver->get_ncols());
+      solver->get_mip_sol(primals.data());
+
+      std::vector<int> mindex(primals.size());
+      std::iota(mindex.begin(), mindex.end(), 0);
+      // complete start
+      SolverAbstract::Ptr started = factory.create_solver(solver_name);
+      started->read_prob_mps(instance, false);
+      started->set_mip_start(mindex, primals);
+      REQUIRE(started->solve_mip() == SOLVER_STATUS::OPTIMAL);
+      REQUIRE(started->get_mip_value() == Approx(optimum));
+
+      // partial start, completed by the solver
+      started->read_prob_mps(instance, false);
+      started->set_mip_start({0}, {primals[0]});
+      REQUIRE(started->solve_mip() == SOLVER_STATUS::OPTIMAL);
+      REQUIRE(started->get_mip_value() == Approx(optimum));
+    }
+  }
+}
+
+TEST_CASE("A MIP solved at a relative gap is within that gap of the optimum",
+          "[solve-mip][mip-gap]") {
+  AllDatas datas;
+  fill_datas(datas);
+
+  SolverFactory factory;
+
+  auto inst = GENERATE(MIP_TOY, MULTIKP);
+  SECTION("Loop on the instances") {
+    for (auto const& solver_name : factory.get_solvers_list()) {
+      // As CLP is a pure LP solver, it cannot pass this test
+      if (solver_name == "CLP") {
+        continue;
+      }
+      std::filesystem::path instance = datas[inst]._path;
+      SolverAbstract::Ptr solver = factory.create_solver(solver_name);
+      solver->read_prob_mps(instance, false);
+      solver->set_mip_relative_gap(0);
+      REQUIRE(solver->solve_mip() == SOLVER_STATUS::OPTIMAL);
+      const double optimum = solver->get_mip_value();
+
+      const double gap = 0.5;
+      SolverAbstract::Ptr loose = factory.create_solver(solver_name);
+      loose->read_prob_mps(instance, false);
+      loose->set_mip_relative_gap(gap);
+      REQUIRE(loose->solve_mip() == SOLVER_STATUS::OPTIMAL);
+      const double value = loose->get_mip_value();
+      REQUIRE(std::abs(value - optimum) <=
+              gap * std::max(std::abs(value), std::abs(optimum)) + 1e-6);
+
+      // the gap is kept for the next solves until changed
+      loose->set_mip_relative_gap(0);
+      REQUIRE(loose->solve_mip() == SOLVER_STATUS::OPTIMAL);
+      REQUIRE(loose->get_mip_value() == Approx(optimum));
+
+      // a negative gap is the solver's default
+      loose->set_mip_relative_gap(gap);
+      loose->set_mip_relative_gap(-1);
+      REQUIRE(loose->solve_mip() == SOLVER_STATUS::OPTIMAL);
+      REQUIRE(loose->get_mip_value() == Approx(optimum).epsilon(1e-4));
+    }
+  }
+}
+
+TEST_CASE("A LP solved at a loose dual tolerance is feasible and close to "
+          "its optimum",
+          "[solve-lp][dual-tolerance]") {
+  AllDatas datas;
+  fill_datas(datas);
+
+  SolverFactory factory;
+
+  auto inst = GENERATE(NET_SP1, NET_SP2);
+  SECTION("Loop on the instances") {
+    for (auto const& solver_name : factory.get_solvers_list()) {
+      SolverAbstract::Ptr solver = factory.create_solver(solver_name);
+      solver->read_prob_mps(datas[inst]._path, false);
+      solver->set_dual_tolerance(1e-2);
+      REQUIRE(solver->solve_lp() == SOLVER_STATUS::OPTIMAL);
+      REQUIRE(solver->get_lp_value() >= datas[inst]._optval - 1e-6);
+
+      // the tolerance is kept for the next solves until changed
+      solver->set_dual_tolerance(1e-7);
+      REQUIRE(solver->solve_lp() == SOLVER_STATUS::OPTIMAL);
+      REQUIRE(Approx(solver->get_lp_value()) == datas[inst]._optval);
+
+      // a negative tolerance is the solver's default
+      solver->set_dual_tolerance(1e-2);
+      solver->set_dual_tolerance(-1);
+      REQUIRE(solver->solve_lp() == SOLVER_STATUS::OPTIMAL);
+      REQUIRE(Approx(solver->get_lp_value()) == datas[inst]._optval);
+    }
+  }
+}
+
+TEST_CASE("A MIP with lazy constraints reaches the optimum of the MIP with "
+          "these rows",
+          "[solve-mip][lazy-constraints]") {
+  AllDatas datas;
+  fill_datas(datas);
+
+  SolverFactory factory;
+
+  for (auto const& solver_name : factory.get_solvers_list()) {
+    std::filesystem::path instance = datas[MULTIKP]._path;
+    SolverAbstract::Ptr solver = factory.create_solver(solver_name);
+    solver->read_prob_mps(instance, false);
+    const int ncols = solver->get_ncols();
+    LazyConstraint constraint;
+    constraint.indexes.resize(ncols);
+    std::iota(constraint.indexes.begin(), constraint.indexes.end(), 0);
+    constraint.values.assign(ncols, 1.0);
+    constraint.rhs = 1;
+
+    int calls = 0;
+    LazyConstraintCallback callback =
+        [&constraint, &calls](const std::vector<double>& solution) {
+          ++calls;
+          double sum = 0;
+          for (auto const value : solution) {
+            sum += value;
+          }
+          return sum > constraint.rhs + 1e-6
+                     ? std::vector<LazyConstraint>{constraint}
+                     : std::vector<LazyConstraint>{};
+        };
+    // only CBC supports them
+    if (solver_name != "CBC") {
+      REQUIRE_THROWS_AS(solver->set_lazy_constraint_callback(callback),
+                        NotImplementedFeatureSolverException);
+      continue;
+    }
+    solver->set_lazy_constraint_callback(callback);
+    REQUIRE(solver->solve_mip() == SOLVER_STATUS::OPTIMAL);
+    REQUIRE(calls > 0);
+    std::vector<double> primals(ncols);
+    solver->get_mip_sol(primals.data());
+    REQUIRE(std::accumulate(primals.begin(), primals.end(), 0.0) <=
+            constraint.rhs + 1e-6);
+    // the lazy constraints are not rows of the problem
+    REQUIRE(solver->get_nrows() == datas[MULTIKP]._nrows);
+
+    SolverAbstract::Ptr reference = factory.create_solver(solver_name);
+    reference->read_prob_mps(instance, false);
+    std::vector<int> rstart = {0, ncols};
+    std::vector<char> rtype(1, 'L');
+    std::vector<double> rhs(1, constraint.rhs);
+    reference->add_rows(1, ncols, rtype.data(), rhs.data(), nullptr,
+                        rstart.data(), constraint.indexes.data(),
+                        constraint.values.data());
+    REQUIRE(reference->solve_mip() == SOLVER_STATUS::OPTIMAL);
+    REQUIRE(solver->get_mip_value() == Approx(reference->get_mip_value()));
+
+    // removing the callback keeps the solution of the branch and bound
+    solver->set_lazy_constraint_callback(nullptr);
+    REQUIRE(solver->get_mip_value() == Approx(reference->get_mip_value()));
+    std::vector<double> kept_primals(ncols);
+    solver->get_mip_sol(kept_primals.data());
+    REQUIRE(kept_primals == primals);
+  }
+}
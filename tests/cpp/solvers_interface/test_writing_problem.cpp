@@ -0,0 +1,226 @@
+#include <chrono>
+#include <iostream>
+
+#include "catch2.hpp"
+#include "define_datas.hpp"
+#include "multisolver_interface/ProblemFileCompression.h"
+#include "multisolver_interface/Solver.h"
+
+void assert_same_problem(SolverAbstract::Ptr expec_solver,
+                         SolverAbstract::Ptr current_solver) {
+  REQUIRE(current_solver->get_ncols() == expec_solver->get_ncols());
+  REQUIRE(current_solver->get_nrows() == expec_solver->get_nrows());
+  REQUIRE(current_solver->get_nelems() == expec_solver->get_nelems());
+  REQUIRE(current_solver->get_n_integer_vars() ==
+          expec_solver->get_n_integer_vars());
+
+  const int n_vars = expec_solver->get_ncols();
+  const int n_cstr = expec_solver->get_nrows();
+  const int n_elems = expec_solver->get_nelems();
+
+  std::vector<double> expec_obj(n_vars), current_obj(n_vars);
+  expec_solver->get_obj(expec_obj.data(), 0, n_vars - 1);
+  current_solver->get_obj(current_obj.data(), 0, n_vars - 1);
+  REQUIRE(current_obj == expec_obj);
+
+  std::vector<double> expec_lb(n_vars), current_lb(n_vars);
+  expec_solver->get_lb(expec_lb.data(), 0, n_vars - 1);
+  current_solver->get_lb(current_lb.data(), 0, n_vars - 1);
+  REQUIRE(current_lb == expec_lb);
+
+  std::vector<double> expec_ub(n_vars), current_ub(n_vars);
+  expec_solver->get_ub(expec_ub.data(), 0, n_vars - 1);
+  current_solver->get_ub(current_ub.data(), 0, n_vars - 1);
+  REQUIRE(current_ub == expec_ub);
+
+  std::vector<char> expec_coltype(n_vars), current_coltype(n_vars);
+  expec_solver->get_col_type(expec_coltype.data(), 0, n_vars - 1);
+  current_solver->get_col_type(current_coltype.data(), 0, n_vars - 1);
+  REQUIRE(current_coltype == expec_coltype);
+
+  REQUIRE(current_solver->get_col_names() == expec_solver->get_col_names());
+
+  if (n_cstr > 0) {
+    std::vector<double> expec_matval(n_elems), current_matval(n_elems);
+    std::vector<int> expec_mstart(n_cstr + 1), current_mstart(n_cstr + 1);
+    std::vector<int> expec_mind(n_elems), current_mind(n_elems);
+    int n_returned(0);
+    expec_solver->get_rows(expec_mstart.data(), expec_mind.data(),
+                           expec_matval.data(), n_elems, &n_returned, 0,
+                           n_cstr - 1);
+    current_solver->get_rows(current_mstart.data(), current_mind.data(),
+                             current_matval.data(), n_elems, &n_returned, 0,
+                             n_cstr - 1);
+    REQUIRE(current_matval == expec_matval);
+    REQUIRE(current_mind == expec_mind);
+    REQUIRE(current_mstart == expec_mstart);
+
+    std::vector<double> expec_rhs(n_cstr), current_rhs(n_cstr);
+    expec_solver->get_rhs(expec_rhs.data(), 0, n_cstr - 1);
+    current_solver->get_rhs(current_rhs.data(), 0, n_cstr - 1);
+    REQUIRE(current_rhs == expec_rhs);
+
+    std::vector<char> expec_rtypes(n_cstr), current_rtypes(n_cstr);
+    expec_solver->get_row_type(expec_rtypes.data(), 0, n_cstr - 1);
+    current_solver->get_row_type(current_rtypes.data(), 0, n_cstr - 1);
+    REQUIRE(current_rtypes == expec_rtypes);
+
+    REQUIRE(current_solver->get_row_names() == expec_solver->get_row_names());
+  }
+}
+
+TEST_CASE("A problem written in MPS is read back identically",
+          "[write][write-mps]") {
+  AllDatas datas;
+  fill_datas(datas);
+
+  SolverFactory factory;
+
+  auto inst = GENERATE(MIP_TOY, LP_TOY, MULTIKP, UNBD_PRB, INFEAS_PRB,
+                       NET_MASTER, NET_SP1, NET_SP2, SLACKS, REDUCED);
+  SECTION("Loop on instances and solvers") {
+    for (auto const& solver_name : factory.get_solvers_list()) {
+      // XPRESS saves its problems in its own binary format
+      if (solver_name == "XPRESS") {
+        continue;
+      }
+      SolverAbstract::Ptr expec_solver = factory.create_solver(solver_name);
+      expec_solver->read_prob_mps(datas[inst]._path, false);
+
+      // shortest round-trip formatting must not lose any digit
+      std::vector<int> mindex = {0};
+      std::vector<double> obj = {0.1 + 0.2};
+      expec_solver->chg_obj(mindex, obj);
+
+      std::filesystem::path written_file = std::tmpnam(nullptr);
+      expec_solver->write_prob_mps(written_file);
+
+      SolverAbstract::Ptr current_solver = factory.create_solver(solver_name);
+      current_solver->read_prob_mps(written_file, false);
+
+      assert_same_problem(expec_solver, current_solver);
+      std::filesystem::remove(written_file);
+    }
+  }
+}
+
+TEST_CASE("A compressed MPS problem is read back identically",
+          "[write][write-mps][compression]") {
+  AllDatas datas;
+  fill_datas(datas);
+
+  SolverFactory factory;
+
+  auto inst = GENERATE(MIP_TOY, LP_TOY, MULTIKP, NET_MASTER, SLACKS);
+  auto extension = GENERATE(".mps.gz", ".mps.zst");
+  SECTION("Loop on instances and solvers") {
+    for (auto const& solver_name : factory.get_solvers_list()) {
+      SolverAbstract::Ptr expec_solver = factory.create_solver(solver_name);
+      expec_solver->read_prob_mps(datas[inst]._path, false);
+
+      const std::filesystem::path base_name = std::tmpnam(nullptr);
+      std::filesystem::path written_file = base_name;
+      written_file += extension;
+      expec_solver->write_prob_mps(written_file);
+      REQUIRE(detect_compression(written_file) ==
+              compression_from_extension(written_file));
+
+      // the compressed file is found from its uncompressed name
+      std::filesystem::path uncompressed_name = base_name;
+      uncompressed_name += ".mps";
+      SolverAbstract::Ptr current_solver = factory.create_solver(solver_name);
+      current_solver->read_prob_mps(uncompressed_name, false);
+
+      assert_same_problem(expec_solver, current_solver);
+      std::filesystem::remove(written_file);
+    }
+  }
+}
+
+TEST_CASE("A truncated compressed problem is rejected",
+          "[write][write-mps][compression]") {
+  AllDatas datas;
+  fill_datas(datas);
+
+  SolverFactory factory;
+  auto extension = GENERATE(".mps.gz", ".mps.zst");
+  SolverAbstract::Ptr solver = factory.create_solver("CBC");
+  solver->read_prob_mps(datas[MULTIKP]._path, false);
+  std::filesystem::path written_file = std::tmpnam(nullptr);
+  written_file += extension;
+  solver->write_prob_mps(written_file);
+  std::filesystem::resize_file(written_file,
+                               std::filesystem::file_size(written_file) / 2);
+
+  const TemporaryProblemFile decompressed(".mps");
+  REQUIRE_THROWS_AS(decompress_file(written_file, decompressed.path()),
+                    GenericSolverException);
+  REQUIRE_THROWS_AS(DecompressedProblemFile(written_file),
+                    GenericSolverException);
+  std::filesystem::remove(written_file);
+}
+
+TEST_CASE("A temporary problem file is unique and removed with its object",
+          "[compression]") {
+  std::filesystem::path first_path;
+  {
+    const TemporaryProblemFile first(".mps");
+    const TemporaryProblemFile second(".mps");
+    first_path = first.path();
+    REQUIRE(std::filesystem::exists(first_path));
+    REQUIRE(first_path.extension() == ".mps");
+    REQUIRE(first_path != second.path());
+  }
+  REQUIRE_FALSE(std::filesystem::exists(first_path));
+}
+
+TEST_CASE("MPS writer throughput", "[.][benchmark][write-mps]") {
+  SolverFactory factory;
+
+  const int n_cols = 1000000;
+  const int n_rows = 200000;
+  const int nnz_per_col = 3;
+  for (auto const& solver_name : factory.get_solvers_list()) {
+    if (solver_name == "XPRESS") {
+      continue;
+    }
+    SolverAbstract::Ptr solver = factory.create_solver(solver_name);
+
+    std::vector<char> rtypes(n_rows, 'L');
+    std::vector<double> rhs(n_rows, 1.0 / 3.0);
+    std::vector<int> rstart(n_rows + 1, 0);
+    std::vector<int> rind(1, 0);
+    std::vector<double> rval(1, 0.0);
+    solver->add_rows(n_rows, 0, rtypes.data(), rhs.data(), nullptr,
+                     rstart.data(), rind.data(), rval.data());
+
+    std::vector<double> obj(n_cols), lb(n_cols, 0.0), ub(n_cols);
+    std::vector<int> mstart(n_cols);
+    std::vector<int> mind(n_cols * nnz_per_col);
+    std::vector<double> matval(n_cols * nnz_per_col);
+    for (int col(0); col < n_cols; col++) {
+      obj[col] = 1.0 + col * 1e-7;
+      ub[col] = 100.0 / (col + 1);
+      mstart[col] = col * nnz_per_col;
+      for (int k(0); k < nnz_per_col; k++) {
+        mind[col * nnz_per_col + k] = (col + k * 7919) % n_rows;
+        matval[col * nnz_per_col + k] = -1.0 / (k + col + 1);
+      }
+    }
+    solver->add_cols(n_cols, n_cols * nnz_per_col, obj.data(), mstart.data(),
+                     mind.data(), matval.data(), lb.data(), ub.data());
+
+    std::filesystem::path written_file = std::tmpnam(nullptr);
+    const auto start = std::chrono::steady_clock::now();
+    solver->write_prob_mps(written_file);
+    const std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start;
+
+    const double megabytes =
+        std::filesystem::file_size(written_file) / (1024. * 1024.);
+    std::cout << solver_name << " : " << megabytes << " MB written in "
+              << elapsed.count() << " s (" << megabytes / elapsed.count()
+              << " MB/s)" << std::endl;
+    std::filesystem::remove(written_file);
+  }
+}
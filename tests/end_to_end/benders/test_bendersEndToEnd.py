@@ -153,3 +153,59 @@ def run_solver(install_dir, solver, tmp_path, allow_run_as_root=False, mpi=False
 
 
 
+
+
+def count_iterations(study_path, options_file, separation_param,
+                     adaptive_separation, command):
+    # runs a copy of the study with the given in-out parameters and returns
+    # the number of iterations and the overall cost
+    with open(study_path / options_file, 'r') as jsonFile:
+        options = json.load(jsonFile)
+    options["SEPARATION_PARAM"] = separation_param
+    options["ADAPTIVE_SEPARATION"] = adaptive_separation
+    options_path = study_path / "options_separation.json"
+    with open(options_path, 'w') as jsonFile:
+        json.dump(options, jsonFile)
+
+    launch_optimization(study_path, command + [options_path.name], 'OPTIMAL')
+    with open(study_path / "expansion/out.json", 'r') as jsonFile:
+        output = json.load(jsonFile)
+    return len(output['iterations']), output['solution']['overall_cost']
+
+
+def compare_separation_params(install_dir, tmp_path, instances,
+                              separation_params):
+    # fixed SEPARATION_PARAM values against the adaptive rule, from the same
+    # initial values: every run reaches the optimum, and the adaptive runs
+    # take at most the iterations of the worst fixed value
+    executable_path = str(
+        (Path(install_dir) / Path(get_conf("BENDERS"))).resolve())
+    with open(RESULT_FILE_PATH, 'r') as jsonFile:
+        expected_results_dict = json.load(jsonFile)
+
+    report = []
+    for instance in instances:
+        expected = expected_results_dict[instance]
+        for separation_param in separation_params:
+            for adaptive_separation in [False, True]:
+                tmp_study = tmp_path / (instance + "-" + str(separation_param) +
+                                        "-" + str(adaptive_separation))
+                shutil.copytree(Path(expected['path']), tmp_study)
+                iterations, value = count_iterations(
+                    tmp_study, expected['option_file'], separation_param,
+                    adaptive_separation, [executable_path])
+                np.testing.assert_allclose(value, expected['optimal_value'],
+                                           rtol=1e-6, atol=0)
+                report.append((instance, separation_param,
+                               adaptive_separation, iterations))
+
+    # from any initial value, the adaptive rule does not do worse than the
+    # worst fixed SEPARATION_PARAM
+    for instance in instances:
+        fixed = [iterations for name, _, adaptive, iterations in report
+                 if name == instance and not adaptive]
+        adaptive = [iterations for name, _, adaptive, iterations in report
+                    if name == instance and adaptive]
+        assert max(adaptive) <= max(fixed), \
+            f"{instance}: adaptive {adaptive} iterations, fixed {fixed}"
+    return report
@@ -1,5 +1,5 @@
 import pytest
-from test_bendersEndToEnd import run_solver
+from test_bendersEndToEnd import compare_separation_params, run_solver
 
 ## TESTS ##
 
@@ -9,3 +9,13 @@ from test_bendersEndToEnd import run_solver
 def test_001_sequential(install_dir, allow_run_as_root, tmp_path, xpress):
     run_solver(install_dir, 'BENDERS', tmp_path,
                allow_run_as_root, False, xpress)
+
+
+@pytest.mark.optim
+@pytest.mark.benderssequential
+def test_002_sequential_adaptive_separation(install_dir, tmp_path):
+    compare_separation_params(install_dir, tmp_path,
+                              ["mini_network_default",
+                               "mini_instance_LP_default",
+                               "mini_instance_MIP_default"],
+                              [0.1, 0.5, 0.9])